@@ -1,8 +1,6 @@
 #include <Orbis/UI.hpp>
-#include <Orbis/Utils.hpp>
 
 using namespace Orbis;
-using std::chrono::steady_clock;
 
 // Your actual game code here, this is just an example.
 struct Player {
@@ -10,15 +8,6 @@ struct Player {
     int mHealthCurrent = 100;
 };
 
-struct AnimationState {
-    bool                     mIsAnimating = false;
-    steady_clock::time_point mStartTime;
-    float                    mFrom     = 0.0f;
-    float                    mTo       = 0.0f;
-    float                    mCurrent  = 0.0f;
-    float                    mDuration = 0.5f;
-};
-
 // more game code...
 
 // SFML Entrance
@@ -40,11 +29,7 @@ int main() {
     window.setVerticalSyncEnabled(false);
 
     // Some game code you desire. this is an example.
-    // Orbis provides some utility functions for UI making such as smooth lerp.
-    Player         player;
-    AnimationState hp_anim;
-
-    hp_anim.mCurrent = static_cast<float>(player.mHealthCurrent) / player.mHealthMax;
+    Player player;
 
     // more game codes...
 
@@ -90,21 +75,27 @@ int main() {
     // things like HUD need to change dynamically as the game progresses.
     // so we declare DYNAMIC stuffs that changes over time!
     // be sure to use auto& instead of auto for dynamic parts.
-    auto& hud_hp_bar  = canvas_hud.GetRect("hud_hp_bar");
     auto& hud_hp_text = canvas_hud.GetText("hud_hp_text");
 
+    // Drawing properties can also be animated. The context runs the animation, no game loop code needed.
+    auto set_health = [&player, &canvas_hud, &hud_hp_text](int health) {
+        player.mHealthCurrent = std::clamp(health, 0, player.mHealthMax);
+        hud_hp_text.mText     = std::to_string(player.mHealthCurrent);
+
+        float ratio = static_cast<float>(player.mHealthCurrent) / player.mHealthMax;
+
+        canvas_hud.SizeAnimation(DrawingType::Rect, "hud_hp_bar", {310 * ratio, 28}, 0.5f);
+    };
+
     button_hp_up
         .SetSize({100, 50})
         .SetPosition({20, 25})
         .SetStateColor(ButtonState::Normal, sf::Color(100, 150, 255, 255))
         .SetStateColor(ButtonState::Hover, sf::Color(120, 170, 255, 255))
         .SetStateColor(ButtonState::Pressed, sf::Color(80, 130, 235, 255))
-        .SetOnButtonPressed([&player, &hp_anim]() {
-            player.mHealthCurrent = std::min(player.mHealthMax, player.mHealthCurrent + 10);
-            hp_anim.mIsAnimating = true;
-            hp_anim.mStartTime = std::chrono::steady_clock::now();
-            hp_anim.mFrom = hp_anim.mCurrent;
-            hp_anim.mTo = static_cast<float>(player.mHealthCurrent) / player.mHealthMax; })
+        .SetOnButtonPressed([&player, &set_health]() {
+            set_health(player.mHealthCurrent + 10);
+        })
         .DrawRect("button_hp_up", {100, 50}, {0, 0}, 0, sf::Color::White, false, 0, sf::Color::White, true, 15.0)
         .DrawText("button_text_hp_up", 16, {50, 25}, 20, sf::Color::Black, font_basic, TextAlign::Center, "HP UP");
 
@@ -114,12 +105,9 @@ int main() {
         .SetStateColor(ButtonState::Normal, sf::Color(100, 150, 255, 255))
         .SetStateColor(ButtonState::Hover, sf::Color(120, 170, 255, 255))
         .SetStateColor(ButtonState::Pressed, sf::Color(80, 130, 235, 255))
-        .SetOnButtonPressed([&player, &hp_anim]() {
-            player.mHealthCurrent = std::max(0, player.mHealthCurrent - 10);
-            hp_anim.mIsAnimating = true;
-            hp_anim.mStartTime = std::chrono::steady_clock::now();
-            hp_anim.mFrom = hp_anim.mCurrent;
-            hp_anim.mTo = static_cast<float>(player.mHealthCurrent) / player.mHealthMax; })
+        .SetOnButtonPressed([&player, &set_health]() {
+            set_health(player.mHealthCurrent - 10);
+        })
         .DrawRect("button_hp_up", {100, 50}, {0, 0}, 0, sf::Color::White, false, 0, sf::Color::White, true, 15.0)
         .DrawText("button_text_hp_down", 16, {50, 25}, 20, sf::Color::Black, font_basic, TextAlign::Center, "HP DOWN");
 
@@ -196,18 +184,6 @@ int main() {
         // NOTICE - UI::Update() and UI::Render() uses window, not a context!
         UI::Update(window);
 
-        if (hp_anim.mIsAnimating == true) {
-            hp_anim.mCurrent = Utils::SmoothLerp(hp_anim.mFrom, hp_anim.mTo, hp_anim.mStartTime, hp_anim.mDuration);
-
-            if (Utils::GetTimeFactor(hp_anim.mStartTime, hp_anim.mDuration) >= 1.0f) {
-                hp_anim.mIsAnimating = false;
-                hp_anim.mCurrent     = hp_anim.mTo;
-            }
-
-            // dynamic elements can be updated IN the game loop!
-            hud_hp_bar.mSize  = {310 * hp_anim.mCurrent, 28};
-            hud_hp_text.mText = std::to_string(player.mHealthCurrent);
-        }
         // Be sure to call UI::Render() after cleaning up the window!
         window.clear();
 
@@ -0,0 +1,100 @@
+#include <atomic>
+#include <thread>
+
+#include <Orbis/UI.hpp>
+
+using namespace Orbis;
+
+// Each window gets its own context and its own thread for update and render.
+// Events are still polled on the main thread, which is where SFML expects it.
+void BuildMonitorPanel(UIContext& context, const std::string& title, sf::Color accent) {
+    // Fonts rasterize glyphs while drawing, so each window thread loads its own copy.
+    auto font   = context.GetResourceVault().LoadFont("./res/roboto.ttf");
+    auto header = UI::CreateWidget<WidgetType::Canvas>();
+    auto button = UI::CreateWidget<WidgetType::Button>();
+
+    header
+        .SetSize({400, 40})
+        .SetPosition({0, 0})
+        .DrawRect("header_bg", {400, 40}, {0, 0}, 0, accent)
+        .DrawText("header_text", 16, {10, 20}, 10, sf::Color::White, font, TextAlign::LeftCenter, title);
+
+    button
+        .SetSize({120, 40})
+        .SetPosition({10, 60})
+        .DrawRect("button_bg", {120, 40}, {0, 0}, 0, sf::Color::White, false, 0, sf::Color::White, true, 10.0f)
+        .DrawText("button_text", 14, {60, 20}, 10, sf::Color::Black, font, TextAlign::Center, "Acknowledge");
+
+    auto panel = UI::CreatePanel();
+
+    panel
+        .SetName(title)
+        .SetSize({400, 200})
+        .SetPosition({20, 20})
+        .AddWidget(header)
+        .AddWidget(button);
+
+    context.AddPanel(panel.GetShared());
+}
+
+int main() {
+    sf::RenderWindow window_left(sf::VideoMode({440, 240}), "Orbis Examples: Multiwindow (Left)", sf::Style::Default);
+    sf::RenderWindow window_right(sf::VideoMode({440, 240}), "Orbis Examples: Multiwindow (Right)", sf::Style::Default);
+
+    UI::Initialize();
+    UIContext context_left  = UI::CreateContext();
+    UIContext context_right = UI::CreateContext();
+
+    UI::Bind(window_left, context_left);
+    UI::Bind(window_right, context_right);
+
+    BuildMonitorPanel(context_left, "Left Monitor", sf::Color(0, 180, 255, 255));
+    BuildMonitorPanel(context_right, "Right Monitor", sf::Color(227, 47, 92, 255));
+
+    std::atomic<bool> is_running = true;
+
+    auto render_loop = [&is_running](sf::RenderWindow& window) {
+        (void)window.setActive(true);
+
+        while (is_running == true) {
+            UI::Update(window);
+
+            window.clear();
+
+            UI::Render(window);
+
+            window.display();
+        }
+
+        (void)window.setActive(false);
+    };
+
+    // The GL context of a window can only be active on one thread at a time.
+    (void)window_left.setActive(false);
+    (void)window_right.setActive(false);
+
+    std::thread thread_left(render_loop, std::ref(window_left));
+    std::thread thread_right(render_loop, std::ref(window_right));
+
+    while (is_running == true) {
+        for (sf::RenderWindow* window : {&window_left, &window_right}) {
+            while (const std::optional event = window->pollEvent()) {
+                if (event->is<sf::Event::Closed>() == true) {
+                    is_running = false;
+                }
+
+                UI::ProcessEvent(*window, *event);
+            }
+        }
+
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+
+    thread_left.join();
+    thread_right.join();
+
+    window_left.close();
+    window_right.close();
+
+    return 0;
+}
\ No newline at end of file
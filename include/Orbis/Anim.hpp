@@ -1,12 +1,19 @@
 #pragma once
 
+#include <algorithm>
+#include <array>
 #include <chrono>
 #include <cmath>
 #include <functional>
 #include <optional>
+#include <type_traits>
 
 #include <SFML/Graphics.hpp>
 
+#include "Orbis/System/Clock.hpp"
+#include "Orbis/System/Enums.hpp"
+#include "Orbis/System/Simd.hpp"
+
 namespace Orbis {
     class Anim {
     public:
@@ -14,8 +21,20 @@ namespace Orbis {
             return std::chrono::duration<float>(end - start).count();
         }
 
+        static std::optional<std::chrono::steady_clock::time_point> GetEarlier(const std::optional<std::chrono::steady_clock::time_point>& a, const std::optional<std::chrono::steady_clock::time_point>& b) {
+            if (a.has_value() == false) {
+                return b;
+            }
+
+            if (b.has_value() == false) {
+                return a;
+            }
+
+            return std::min(*a, *b);
+        }
+
         static float GetTimeFactor(const std::chrono::steady_clock::time_point& start, float durationSeconds) {
-            auto  now     = std::chrono::steady_clock::now();
+            auto  now     = Clock::GetNow();
             float elapsed = GetElapsedSeconds(start, now);
 
             return std::min(1.0f, elapsed / durationSeconds);
@@ -31,8 +50,14 @@ namespace Orbis {
             return from + smooth * (to - from);
         }
 
+        static float EaseLinear(float t) {
+            return t;
+        }
+
         static float EaseInOutCubic(float t) {
-            return t < 0.5f ? 4.0f * t * t * t : 1.0f - std::pow(-2.0f * t + 2.0f, 3.0f) / 2.0f;
+            float p = -2.0f * t + 2.0f;
+
+            return t < 0.5f ? 4.0f * t * t * t : 1.0f - p * p * p / 2.0f;
         }
 
         static float EaseOutQuad(float t) {
@@ -81,6 +106,92 @@ namespace Orbis {
             return std::pow(2.0f, -10.0f * t) * std::sin((t * 10.0f - 0.75f) * c4) + 1.0f;
         }
 
+        static float Lerp(float from, float to, float t) {
+            return from + (to - from) * t;
+        }
+
+        static sf::Color LerpColor(sf::Color from, sf::Color to, float t) {
+            auto channel = [t](std::uint8_t a, std::uint8_t b) {
+                return static_cast<std::uint8_t>(std::lround(std::clamp(Lerp(a, b, t), 0.0f, 255.0f)));
+            };
+
+            return sf::Color(channel(from.r, to.r), channel(from.g, to.g), channel(from.b, to.b), channel(from.a, to.a));
+        }
+
+        // Resolved at compile time, so a loop over one easing inlines it
+        template <Easing E>
+        static float Ease(float t) {
+            if constexpr (E == Easing::InQuad) {
+                return EaseInQuad(t);
+            }
+            else if constexpr (E == Easing::OutQuad) {
+                return EaseOutQuad(t);
+            }
+            else if constexpr (E == Easing::InOutCubic) {
+                return EaseInOutCubic(t);
+            }
+            else if constexpr (E == Easing::InBounce) {
+                return EaseInBounce(t);
+            }
+            else if constexpr (E == Easing::OutBounce) {
+                return EaseOutBounce(t);
+            }
+            else if constexpr (E == Easing::OutElastic) {
+                return EaseOutElastic(t);
+            }
+            else {
+                return EaseLinear(t);
+            }
+        }
+
+        // Easings built from arithmetic alone, which EaseBatch() evaluates a whole batch of lanes at a time
+        static constexpr bool IsBatchable(Easing easing) {
+            return easing != Easing::OutElastic && easing != Easing::Custom;
+        }
+
+        static Simd::Batch EaseOutBounceBatch(Simd::Batch t) {
+            const float n1 = 7.5625f;
+            const float d1 = 2.75f;
+
+            Simd::Batch t2 = t - Simd::Set(1.5f / d1);
+            Simd::Batch t3 = t - Simd::Set(2.25f / d1);
+            Simd::Batch t4 = t - Simd::Set(2.625f / d1);
+            Simd::Batch r1 = Simd::Set(n1) * t * t;
+            Simd::Batch r2 = Simd::Set(n1) * t2 * t2 + Simd::Set(0.75f);
+            Simd::Batch r3 = Simd::Set(n1) * t3 * t3 + Simd::Set(0.9375f);
+            Simd::Batch r4 = Simd::Set(n1) * t4 * t4 + Simd::Set(0.984375f);
+
+            return Simd::Select(t < Simd::Set(1.0f / d1), r1, Simd::Select(t < Simd::Set(2.0f / d1), r2, Simd::Select(t < Simd::Set(2.5f / d1), r3, r4)));
+        }
+
+        template <Easing E>
+        static Simd::Batch EaseBatch(Simd::Batch t) {
+            static_assert(IsBatchable(E) == true, "Easing has no batch form");
+
+            Simd::Batch one = Simd::Set(1.0f);
+
+            if constexpr (E == Easing::InQuad) {
+                return t * t;
+            }
+            else if constexpr (E == Easing::OutQuad) {
+                return one - (one - t) * (one - t);
+            }
+            else if constexpr (E == Easing::InOutCubic) {
+                Simd::Batch p = Simd::Set(2.0f) - Simd::Set(2.0f) * t;
+
+                return Simd::Select(t < Simd::Set(0.5f), Simd::Set(4.0f) * t * t * t, one - p * p * p * Simd::Set(0.5f));
+            }
+            else if constexpr (E == Easing::InBounce) {
+                return one - EaseOutBounceBatch(one - t);
+            }
+            else if constexpr (E == Easing::OutBounce) {
+                return EaseOutBounceBatch(t);
+            }
+            else {
+                return t;
+            }
+        }
+
         static sf::Vector2f LerpVector(sf::Vector2f from, sf::Vector2f to, float t) {
             return {from.x + (to.x - from.x) * t, from.y + (to.y - from.y) * t};
         }
@@ -108,6 +219,119 @@ namespace Orbis {
         }
     };
 
+    // Samples of an easing over [0, 1], linearly interpolated, for easings that need pow/sin per evaluation
+    class EasingTable {
+    private:
+        static constexpr size_t Resolution = 256;
+
+        std::array<float, Resolution + 1> mSamples;
+
+        EasingTable(float (*easing)(float)) {
+            for (size_t i = 0; i <= Resolution; ++i) {
+                mSamples[i] = easing(static_cast<float>(i) / Resolution);
+            }
+        }
+
+    public:
+        static constexpr bool IsTabulated(Easing easing) {
+            return easing == Easing::OutElastic;
+        }
+
+        template <Easing E>
+        static const EasingTable& Get() {
+            static const EasingTable table(&Anim::Ease<E>);
+
+            return table;
+        }
+
+        float Sample(float t) const {
+            float  x     = std::clamp(t, 0.0f, 1.0f) * Resolution;
+            size_t index = std::min(static_cast<size_t>(x), Resolution - 1);
+
+            return Anim::Lerp(mSamples[index], mSamples[index + 1], x - static_cast<float>(index));
+        }
+    };
+
+    // Either a built-in easing, dispatched by the scheduler once per batch, or a custom function called per tween.
+    // Passing one of Anim's easing functions selects the matching built-in.
+    class EasingCurve {
+    private:
+        Easing                      mKind = Easing::OutQuad;
+        std::function<float(float)> mCustom;
+
+    public:
+        EasingCurve(Easing kind = Easing::OutQuad) : mKind(kind) {};
+
+        EasingCurve(float (*func)(float)) : mKind(Easing::Custom), mCustom(func) {
+            if (func == nullptr || func == &Anim::EaseLinear) {
+                mKind = Easing::Linear;
+            }
+            else if (func == &Anim::EaseInQuad) {
+                mKind = Easing::InQuad;
+            }
+            else if (func == &Anim::EaseOutQuad) {
+                mKind = Easing::OutQuad;
+            }
+            else if (func == &Anim::EaseInOutCubic) {
+                mKind = Easing::InOutCubic;
+            }
+            else if (func == &Anim::EaseInBounce) {
+                mKind = Easing::InBounce;
+            }
+            else if (func == &Anim::EaseOutBounce) {
+                mKind = Easing::OutBounce;
+            }
+            else if (func == &Anim::EaseOutElastic) {
+                mKind = Easing::OutElastic;
+            }
+
+            if (mKind != Easing::Custom) {
+                mCustom = nullptr;
+            }
+        }
+
+        template <typename F>
+        requires std::is_invocable_r_v<float, F, float>
+        EasingCurve(F func) : mKind(Easing::Custom), mCustom(std::move(func)) {
+            if (!mCustom) {
+                mKind = Easing::Linear;
+            }
+        }
+
+        Easing GetKind() const {
+            return mKind;
+        }
+
+        float operator()(float t) const {
+            switch (mKind) {
+                case Easing::InQuad: {
+                    return Anim::Ease<Easing::InQuad>(t);
+                }
+                case Easing::OutQuad: {
+                    return Anim::Ease<Easing::OutQuad>(t);
+                }
+                case Easing::InOutCubic: {
+                    return Anim::Ease<Easing::InOutCubic>(t);
+                }
+                case Easing::InBounce: {
+                    return Anim::Ease<Easing::InBounce>(t);
+                }
+                case Easing::OutBounce: {
+                    return Anim::Ease<Easing::OutBounce>(t);
+                }
+                case Easing::OutElastic: {
+                    return Anim::Ease<Easing::OutElastic>(t);
+                }
+                case Easing::Custom: {
+                    return mCustom(t);
+                }
+                default: {
+                    return t;
+                }
+            }
+        }
+    };
+
     struct AnimationState {
         bool                                  mIsActive = false;
         std::chrono::steady_clock::time_point mStartTime;
@@ -128,7 +352,7 @@ namespace Orbis {
                 return false;
             }
 
-            auto now = std::chrono::steady_clock::now();
+            auto now = Clock::GetNow();
 
             return mDuration <= Anim::GetElapsedSeconds(mStartTime, now);
         }
@@ -148,7 +372,7 @@ namespace Orbis {
 
         void Start(sf::Vector2f start, sf::Vector2f target, float duration, std::function<void()> on_complete = nullptr) {
             mIsActive   = true;
-            mStartTime  = std::chrono::steady_clock::now();
+            mStartTime  = Clock::GetNow();
             mDuration   = duration;
             mStartPos   = start;
             mTargetPos  = target;
@@ -156,7 +380,8 @@ namespace Orbis {
         }
     };
 
-    class DelayedCallback {
+    // Needs an Update() per frame of its own; prefer UIContext::GetTimers()
+    class [[deprecated("Use UIContext::GetTimers()")]] DelayedCallback {
     private:
         bool                                  mIsActive = false;
         std::chrono::steady_clock::time_point mStartTime;
@@ -170,7 +395,7 @@ namespace Orbis {
 
         void Start(float delay_seconds, std::function<void()> callback) {
             mIsActive  = true;
-            mStartTime = std::chrono::steady_clock::now();
+            mStartTime = Clock::GetNow();
             mDelay     = delay_seconds;
             mCallback  = std::move(callback);
         }
@@ -180,7 +405,7 @@ namespace Orbis {
                 return;
             }
 
-            auto  now     = std::chrono::steady_clock::now();
+            auto  now     = Clock::GetNow();
             float elapsed = Anim::GetElapsedSeconds(mStartTime, now);
 
             if (elapsed >= mDelay) {
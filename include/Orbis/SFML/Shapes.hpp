@@ -27,16 +27,18 @@ namespace sf {
         return vertices;
     }
 
-    sf::ConvexShape RectRounded(const sf::Vector2f& size, float radius, size_t corner_segments = 10) {
+    // Rewrites the points of an existing shape, which keeps its vertex storage when the point count is unchanged
+    inline void RectRounded(sf::ConvexShape& shape, const sf::Vector2f& size, float radius, size_t corner_segments = 10) {
         const float PI         = 3.1415;
         float       radius_max = std::min(size.x, size.y) / 2.0f;
 
         radius = std::min(radius, radius_max);
 
-        size_t          points_total = corner_segments * 4;
-        float           angle_step   = ((PI / 2.0f) / static_cast<float>(corner_segments));
-        size_t          index        = 0;
-        sf::ConvexShape shape(points_total);
+        size_t points_total = corner_segments * 4;
+        float  angle_step   = ((PI / 2.0f) / static_cast<float>(corner_segments));
+        size_t index        = 0;
+
+        shape.setPointCount(points_total);
 
         for (size_t i = 0; i < corner_segments; ++i) {
             float angle = ((-PI / 2.0f) + (static_cast<float>(i) * angle_step));
@@ -69,6 +71,12 @@ namespace sf {
 
             shape.setPoint(index++, {x, y});
         }
+    }
+
+    sf::ConvexShape RectRounded(const sf::Vector2f& size, float radius, size_t corner_segments = 10) {
+        sf::ConvexShape shape;
+
+        RectRounded(shape, size, radius, corner_segments);
 
         return shape;
     }
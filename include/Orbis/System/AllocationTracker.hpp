@@ -0,0 +1,160 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <cstdlib>
+#include <new>
+
+#ifdef _MSC_VER
+#include <malloc.h>
+#endif
+
+namespace Orbis {
+    // Counts global operator new calls, to verify that a steady-state frame doesn't touch the heap:
+    //
+    //     Orbis::AllocationScope scope;
+    //     Orbis::UI::Update(window);
+    //     Orbis::UI::Render(window);
+    //     assert(scope.GetAllocations() == 0);
+    //
+    // Counting needs the replacement operators, compiled into exactly one translation unit:
+    //
+    //     #define ORBIS_ALLOCATION_TRACKER_IMPLEMENTATION
+    //     #include "Orbis/System/AllocationTracker.hpp"
+    //
+    // Plain, array, nothrow and over-aligned forms are all counted. Without them the count simply stays at zero.
+    class AllocationTracker {
+    public:
+        static std::atomic<uint64_t>& GetCounter() {
+            static std::atomic<uint64_t> counter = 0;
+
+            return counter;
+        }
+
+        static uint64_t GetCount() {
+            return GetCounter().load(std::memory_order_relaxed);
+        }
+    };
+
+    // Allocations made on any thread since construction
+    class AllocationScope {
+    private:
+        uint64_t mStart;
+
+    public:
+        AllocationScope() : mStart(AllocationTracker::GetCount()) {};
+
+        uint64_t GetAllocations() const {
+            return AllocationTracker::GetCount() - mStart;
+        }
+    };
+} // namespace Orbis
+
+#ifdef ORBIS_ALLOCATION_TRACKER_IMPLEMENTATION
+// GCC inlines these into their callers at -O2 and then takes std::free() on the result of new for a mismatch
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmismatched-new-delete"
+#endif
+
+void* operator new(std::size_t size) {
+    Orbis::AllocationTracker::GetCounter().fetch_add(1, std::memory_order_relaxed);
+
+    if (void* ptr = std::malloc(size == 0 ? 1 : size)) {
+        return ptr;
+    }
+
+    throw std::bad_alloc();
+}
+
+void* operator new[](std::size_t size) {
+    return operator new(size);
+}
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept {
+    Orbis::AllocationTracker::GetCounter().fetch_add(1, std::memory_order_relaxed);
+
+    return std::malloc(size == 0 ? 1 : size);
+}
+
+void* operator new[](std::size_t size, const std::nothrow_t& tag) noexcept {
+    return operator new(size, tag);
+}
+
+void operator delete(void* ptr) noexcept {
+    std::free(ptr);
+}
+
+void operator delete[](void* ptr) noexcept {
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept {
+    std::free(ptr);
+}
+
+void operator delete[](void* ptr, std::size_t) noexcept {
+    std::free(ptr);
+}
+
+// Over-aligned types (alignas beyond the default) come through these; MSVC can't free them with std::free
+void* operator new(std::size_t size, std::align_val_t alignment) {
+    Orbis::AllocationTracker::GetCounter().fetch_add(1, std::memory_order_relaxed);
+
+    std::size_t align   = static_cast<std::size_t>(alignment);
+    std::size_t rounded = (size + align - 1) / align * align;
+
+#ifdef _MSC_VER
+    if (void* ptr = _aligned_malloc(rounded == 0 ? align : rounded, align)) {
+        return ptr;
+    }
+#else
+    if (void* ptr = std::aligned_alloc(align, rounded == 0 ? align : rounded)) {
+        return ptr;
+    }
+#endif
+
+    throw std::bad_alloc();
+}
+
+void* operator new[](std::size_t size, std::align_val_t alignment) {
+    return operator new(size, alignment);
+}
+
+void* operator new(std::size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept {
+    try {
+        return operator new(size, alignment);
+    }
+    catch (...) {
+        return nullptr;
+    }
+}
+
+void* operator new[](std::size_t size, std::align_val_t alignment, const std::nothrow_t& tag) noexcept {
+    return operator new(size, alignment, tag);
+}
+
+void operator delete(void* ptr, std::align_val_t) noexcept {
+#ifdef _MSC_VER
+    _aligned_free(ptr);
+#else
+    std::free(ptr);
+#endif
+}
+
+void operator delete[](void* ptr, std::align_val_t alignment) noexcept {
+    operator delete(ptr, alignment);
+}
+
+void operator delete(void* ptr, std::size_t, std::align_val_t alignment) noexcept {
+    operator delete(ptr, alignment);
+}
+
+void operator delete[](void* ptr, std::size_t, std::align_val_t alignment) noexcept {
+    operator delete(ptr, alignment);
+}
+
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#endif
\ No newline at end of file
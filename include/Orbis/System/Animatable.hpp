@@ -0,0 +1,193 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+#include <SFML/Graphics.hpp>
+
+#include "Orbis/Anim.hpp"
+#include "Orbis/System/Enums.hpp"
+
+namespace Orbis {
+    // Anything a scheduler can drive: widgets, panels and individual drawings.
+    // Requesting a tween bumps the target's generation for that property, so a running tween with an older one is
+    // dropped without completing. Copies start out with no tweens.
+    class Animatable {
+    private:
+        std::array<uint32_t, static_cast<size_t>(TweenProperty::Count)> mTweenGenerations = {};
+        uint32_t                                                        mActiveTweens     = 0;
+
+    public:
+        Animatable() = default;
+
+        Animatable(const Animatable&) {};
+
+        Animatable& operator=(const Animatable&) {
+            return *this;
+        }
+
+        virtual ~Animatable() = default;
+
+        uint32_t GetTweenGeneration(TweenProperty property) const {
+            return mTweenGenerations[static_cast<size_t>(property)];
+        }
+
+        // Supersedes whatever tween is running on the property, returns the generation for the next one
+        uint32_t BeginTween(TweenProperty property) {
+            return ++mTweenGenerations[static_cast<size_t>(property)];
+        }
+
+        // Tweens handed to a scheduler and not yet finished, maintained by the scheduler
+        uint32_t GetActiveTweens() const {
+            return mActiveTweens;
+        }
+
+        void OnTweenStarted() {
+            ++mActiveTweens;
+        }
+
+        void OnTweenEnded() {
+            --mActiveTweens;
+        }
+
+        // Return false for properties the target doesn't have
+        virtual bool ApplyTween(TweenProperty property, sf::Vector2f value) {
+            (void)property;
+            (void)value;
+
+            return false;
+        }
+
+        virtual bool ApplyTween(TweenProperty property, sf::Color value) {
+            (void)property;
+            (void)value;
+
+            return false;
+        }
+
+        virtual bool ApplyTween(TweenProperty property, float value) {
+            (void)property;
+            (void)value;
+
+            return false;
+        }
+    };
+
+    // Tweens submitted on behalf of one panel, suspended while it's hidden
+    struct AnimationGroup {
+        SuspendPolicy mPolicy       = SuspendPolicy::Run;
+        bool          mIsSuspended  = false;
+        uint32_t      mActiveTweens = 0; // in the scheduler's lanes, kept up by the lanes themselves
+    };
+
+    // A requested tween, before a scheduler picks it up
+    template <typename T>
+    struct Tween {
+        std::weak_ptr<Animatable>   mTarget;               // left empty for the requesting widget or panel itself
+        Animatable*                 mObject     = nullptr; // the target, to tell requests on the owner apart
+        TweenProperty               mProperty   = TweenProperty::Position;
+        uint32_t                    mGeneration = 0;
+        T                           mFrom       = {};
+        T                           mTo         = {};
+        float                       mDuration   = 0.0f;
+        EasingCurve                 mEasing     = Easing::OutQuad;
+        std::function<void()>       mOnComplete = nullptr;
+    };
+
+    // How a spring pulls toward its target; the default settles in about half a second without overshooting
+    struct SpringParams {
+        float mStiffness    = 200.0f; // acceleration per unit of distance from the target
+        float mDampingRatio = 1.0f;   // 1 settles fastest without overshoot, lower bounces, higher creeps
+        float mPrecision    = 0.01f;  // distance and speed below which the spring snaps onto its target
+
+        float GetDamping() const {
+            return 2.0f * mDampingRatio * std::sqrt(mStiffness);
+        }
+    };
+
+    // A requested spring. If the property's spring is still running it only moves that spring's target, keeping its
+    // value and velocity, otherwise it starts from mFrom at rest and supersedes any tween on the property.
+    template <typename T>
+    struct Spring {
+        std::weak_ptr<Animatable> mTarget;
+        Animatable*               mObject     = nullptr;
+        TweenProperty             mProperty   = TweenProperty::Position;
+        uint32_t                  mGeneration = 0; // of the property when requested, a later tween or cancel drops it
+        T                         mFrom       = {};
+        T                         mTo         = {};
+        SpringParams              mParams;
+        std::function<void()>     mOnComplete = nullptr;
+    };
+
+    // Tweens requested on a widget or panel, which doesn't know its context, until its next update submits them
+    class TweenQueue {
+    private:
+        std::vector<Tween<sf::Vector2f>>  mVectors;
+        std::vector<Tween<sf::Color>>     mColors;
+        std::vector<Tween<float>>         mFloats;
+        std::vector<Spring<sf::Vector2f>> mSprings;
+
+    public:
+        bool IsEmpty() const {
+            return mVectors.empty() == true && mColors.empty() == true && mFloats.empty() == true && mSprings.empty() == true;
+        }
+
+        std::vector<Spring<sf::Vector2f>>& GetSprings() {
+            return mSprings;
+        }
+
+        template <typename T>
+        std::vector<Tween<T>>& Get() {
+            if constexpr (std::is_same_v<T, sf::Vector2f>) {
+                return mVectors;
+            }
+            else if constexpr (std::is_same_v<T, sf::Color>) {
+                return mColors;
+            }
+            else {
+                return mFloats;
+            }
+        }
+
+        template <typename T>
+        void Push(Animatable& target, std::weak_ptr<Animatable> target_ref, TweenProperty property, T from, T to, float duration, std::function<void()> on_complete, EasingCurve easing) {
+            Tween<T> tween;
+
+            tween.mTarget     = std::move(target_ref);
+            tween.mObject     = &target;
+            tween.mProperty   = property;
+            tween.mGeneration = target.BeginTween(property);
+            tween.mFrom       = from;
+            tween.mTo         = to;
+            tween.mDuration   = duration;
+            tween.mEasing     = std::move(easing);
+            tween.mOnComplete = std::move(on_complete);
+
+            Get<T>().push_back(std::move(tween));
+        }
+
+        // A second request on the same property before the next submit replaces the first
+        void PushSpring(Animatable& target, std::weak_ptr<Animatable> target_ref, TweenProperty property, sf::Vector2f from, sf::Vector2f to, SpringParams params, std::function<void()> on_complete) {
+            auto iter = std::find_if(mSprings.begin(), mSprings.end(), [&](const Spring<sf::Vector2f>& spring) { return spring.mObject == &target && spring.mProperty == property; });
+
+            if (iter == mSprings.end()) {
+                iter = mSprings.emplace(mSprings.end());
+            }
+
+            iter->mTarget     = std::move(target_ref);
+            iter->mObject     = &target;
+            iter->mProperty   = property;
+            iter->mGeneration = target.GetTweenGeneration(property);
+            iter->mFrom       = from;
+            iter->mTo         = to;
+            iter->mParams     = params;
+            iter->mOnComplete = std::move(on_complete);
+        }
+    };
+} // namespace Orbis
\ No newline at end of file
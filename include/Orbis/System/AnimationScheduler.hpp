@@ -0,0 +1,958 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <unordered_map>
+#include <vector>
+
+#include <SFML/Graphics.hpp>
+
+#include "Orbis/Anim.hpp"
+#include "Orbis/System/Animatable.hpp"
+#include "Orbis/System/ChangeCounter.hpp"
+#include "Orbis/System/Clock.hpp"
+#include "Orbis/System/Timeline.hpp"
+
+namespace Orbis {
+    // How a tweened value splits into float channels, so lanes of the same channel can be interpolated together
+    template <typename T>
+    struct TweenChannels;
+
+    template <>
+    struct TweenChannels<sf::Vector2f> {
+        static constexpr size_t Count = 2;
+
+        static std::array<float, Count> Split(sf::Vector2f value) {
+            return {value.x, value.y};
+        }
+
+        static sf::Vector2f Join(const std::array<std::vector<float>, Count>& channels, size_t index) {
+            return {channels[0][index], channels[1][index]};
+        }
+    };
+
+    template <>
+    struct TweenChannels<sf::Color> {
+        static constexpr size_t Count = 4;
+
+        static std::array<float, Count> Split(sf::Color value) {
+            return {float(value.r), float(value.g), float(value.b), float(value.a)};
+        }
+
+        static uint8_t ToByte(float value) {
+            return static_cast<uint8_t>(std::clamp(value + 0.5f, 0.0f, 255.0f));
+        }
+
+        static sf::Color Join(const std::array<std::vector<float>, Count>& channels, size_t index) {
+            return {ToByte(channels[0][index]), ToByte(channels[1][index]), ToByte(channels[2][index]), ToByte(channels[3][index])};
+        }
+    };
+
+    template <>
+    struct TweenChannels<float> {
+        static constexpr size_t Count = 1;
+
+        static std::array<float, Count> Split(float value) {
+            return {value};
+        }
+
+        static float Join(const std::array<std::vector<float>, Count>& channels, size_t index) {
+            return channels[0][index];
+        }
+    };
+
+    // Inputs and results of one frame, shared by every set of lanes
+    struct TweenFrame {
+        float                              mNow     = 0.0f; // seconds since the scheduler's epoch
+        float                              mDelta   = 0.0f; // seconds since the previous frame
+        size_t                             mRunning = 0;    // tweens left that write a value every frame
+        std::optional<float>               mNextEnd;        // earliest end of a suspended tween that keeps time
+        std::vector<std::function<void()>> mCompletions;    // callbacks of the tweens that finished
+    };
+
+    // Running tweens of one value type and one easing, in parallel float arrays so a frame can evaluate
+    // Simd::Width of them per instruction. Times are seconds since the scheduler's epoch.
+    template <typename T>
+    class TweenLanes {
+    private:
+        static constexpr size_t Channels = TweenChannels<T>::Count;
+
+        struct Target {
+            std::weak_ptr<Animatable> mOwner; // only checked for expiry, applied through mObject
+            Animatable*               mObject     = nullptr;
+            TweenProperty             mProperty   = TweenProperty::Position;
+            uint32_t                  mGeneration = 0;
+
+            std::shared_ptr<AnimationGroup> mGroup; // empty for tweens outside of any panel
+        };
+
+        std::vector<Target>                      mTargets;
+        std::vector<float>                       mStarts;
+        std::vector<float>                       mEnds;
+        std::vector<float>                       mInvDurations; // 0 for tweens that jump straight to their target
+        std::array<std::vector<float>, Channels> mFrom;
+        std::array<std::vector<float>, Channels> mTo;
+        std::vector<std::function<float(float)>> mCustom;       // only filled in the Easing::Custom lanes
+        std::vector<std::function<void()>>       mOnCompletes;
+
+        // Scratch reused every frame
+        std::array<std::vector<float>, Channels> mValues;
+        std::vector<uint32_t>                    mFinished;
+
+        void RemoveAt(size_t index) {
+            size_t last = mTargets.size() - 1;
+
+            if (mTargets[index].mGroup != nullptr) {
+                --mTargets[index].mGroup->mActiveTweens;
+            }
+
+            if (index != last) {
+                mTargets[index]      = std::move(mTargets[last]);
+                mStarts[index]       = mStarts[last];
+                mEnds[index]         = mEnds[last];
+                mInvDurations[index] = mInvDurations[last];
+                mOnCompletes[index]  = std::move(mOnCompletes[last]);
+
+                for (size_t c = 0; c < Channels; ++c) {
+                    mFrom[c][index] = mFrom[c][last];
+                    mTo[c][index]   = mTo[c][last];
+                }
+
+                if (mCustom.empty() == false) {
+                    mCustom[index] = std::move(mCustom[last]);
+                }
+            }
+
+            mTargets.pop_back();
+            mStarts.pop_back();
+            mEnds.pop_back();
+            mInvDurations.pop_back();
+            mOnCompletes.pop_back();
+
+            for (size_t c = 0; c < Channels; ++c) {
+                mFrom[c].pop_back();
+                mTo[c].pop_back();
+            }
+
+            if (mCustom.empty() == false) {
+                mCustom.pop_back();
+            }
+        }
+
+        template <Easing E>
+        float EaseLane(size_t index, float t, bool is_tabulated) const {
+            if constexpr (E == Easing::Custom) {
+                return mCustom[index](t);
+            }
+            else if constexpr (EasingTable::IsTabulated(E) == true) {
+                return is_tabulated == true ? EasingTable::Get<E>().Sample(t) : Anim::Ease<E>(t);
+            }
+            else {
+                return Anim::Ease<E>(t);
+            }
+        }
+
+    public:
+        size_t GetSize() const {
+            return mTargets.size();
+        }
+
+        void Start(Tween<T>&& tween, Animatable* object, std::shared_ptr<AnimationGroup> group, float start) {
+            std::array<float, Channels> from = TweenChannels<T>::Split(tween.mFrom);
+            std::array<float, Channels> to   = TweenChannels<T>::Split(tween.mTo);
+
+            if (group != nullptr) {
+                ++group->mActiveTweens;
+            }
+
+            mTargets.push_back({std::move(tween.mTarget), object, tween.mProperty, tween.mGeneration, std::move(group)});
+            mStarts.push_back(start);
+            mEnds.push_back(start + std::max(tween.mDuration, 0.0f));
+            mInvDurations.push_back(0.0f < tween.mDuration ? 1.0f / tween.mDuration : 0.0f);
+            mOnCompletes.push_back(std::move(tween.mOnComplete));
+
+            for (size_t c = 0; c < Channels; ++c) {
+                mFrom[c].push_back(from[c]);
+                mTo[c].push_back(to[c]);
+            }
+
+            if (tween.mEasing.GetKind() == Easing::Custom) {
+                mCustom.push_back(std::move(tween.mEasing));
+            }
+        }
+
+        // Keeps the float times small as the epoch moves forward
+        void Rebase(float shift) {
+            for (size_t i = 0; i < mTargets.size(); ++i) {
+                mStarts[i] -= shift;
+                mEnds[i]   -= shift;
+            }
+        }
+
+        void Clear() {
+            for (const Target& target : mTargets) {
+                if (target.mOwner.expired() == false) {
+                    target.mObject->OnTweenEnded();
+                }
+
+                if (target.mGroup != nullptr) {
+                    --target.mGroup->mActiveTweens;
+                }
+            }
+
+            mTargets.clear();
+            mStarts.clear();
+            mEnds.clear();
+            mInvDurations.clear();
+            mCustom.clear();
+            mOnCompletes.clear();
+
+            for (size_t c = 0; c < Channels; ++c) {
+                mFrom[c].clear();
+                mTo[c].clear();
+            }
+        }
+
+        // Time factor, clamp, easing and lerp of every lane into mValues; finished tweens land exactly on their target
+        template <Easing E>
+        void Evaluate(float now, bool is_tabulated) {
+            size_t count = mTargets.size();
+            size_t i     = 0;
+
+            for (size_t c = 0; c < Channels; ++c) {
+                mValues[c].resize(count);
+            }
+
+            if constexpr (Anim::IsBatchable(E) == true) {
+                Simd::Batch now_batch = Simd::Set(now);
+                Simd::Batch one       = Simd::Set(1.0f);
+
+                for (; i + Simd::Width <= count; i += Simd::Width) {
+                    Simd::Batch t = Simd::Clamp((now_batch - Simd::Load(&mStarts[i])) * Simd::Load(&mInvDurations[i]), 0.0f, 1.0f);
+
+                    t = Simd::Select(now_batch < Simd::Load(&mEnds[i]), Anim::EaseBatch<E>(t), one);
+
+                    for (size_t c = 0; c < Channels; ++c) {
+                        Simd::Batch from = Simd::Load(&mFrom[c][i]);
+
+                        Simd::Store(&mValues[c][i], from + (Simd::Load(&mTo[c][i]) - from) * t);
+                    }
+                }
+            }
+
+            // Remainder of a partial batch, and every lane of the easings without a batch form
+            for (; i < count; ++i) {
+                float t = std::clamp((now - mStarts[i]) * mInvDurations[i], 0.0f, 1.0f);
+
+                t = now < mEnds[i] ? EaseLane<E>(i, t, is_tabulated) : 1.0f;
+
+                for (size_t c = 0; c < Channels; ++c) {
+                    mValues[c][i] = Anim::Lerp(mFrom[c][i], mTo[c][i], t);
+                }
+            }
+        }
+
+        // Writes the evaluated values; finished tweens hand their callbacks to the frame instead of running them
+        void Apply(TweenFrame& frame) {
+            float now = frame.mNow;
+
+            mFinished.clear();
+
+            for (uint32_t i = 0; i < mTargets.size(); ++i) {
+                Target& target = mTargets[i];
+
+                if (target.mOwner.expired() == true) {
+                    mFinished.push_back(i);
+
+                    continue;
+                }
+
+                // Superseded or cancelled since it started
+                if (target.mObject->GetTweenGeneration(target.mProperty) != target.mGeneration) {
+                    target.mObject->OnTweenEnded();
+                    mFinished.push_back(i);
+
+                    continue;
+                }
+
+                bool is_final = (now < mEnds[i]) == false;
+
+                if (target.mGroup != nullptr && target.mGroup->mIsSuspended == true) {
+                    switch (target.mGroup->mPolicy) {
+                        case SuspendPolicy::Pause: {
+                            mStarts[i] += frame.mDelta;
+                            mEnds[i]   += frame.mDelta;
+
+                            continue;
+                        }
+                        case SuspendPolicy::FastForward: {
+                            // Due as soon as the group resumes
+                            mEnds[i] = std::min(mEnds[i], now);
+
+                            continue;
+                        }
+                        default: {
+                            if (is_final == false) {
+                                frame.mNextEnd = std::min(frame.mNextEnd.value_or(mEnds[i]), mEnds[i]);
+
+                                continue;
+                            }
+
+                            break;
+                        }
+                    }
+                }
+
+                bool is_applied = target.mObject->ApplyTween(target.mProperty, TweenChannels<T>::Join(mValues, i));
+
+                if (is_applied == false || is_final == true) {
+                    target.mObject->OnTweenEnded();
+                    mFinished.push_back(i);
+
+                    if (is_applied == true && mOnCompletes[i]) {
+                        frame.mCompletions.push_back(std::move(mOnCompletes[i]));
+                    }
+
+                    continue;
+                }
+
+                ++frame.mRunning;
+            }
+
+            // Back to front, so a swap with the last element never moves a tween that is still to be removed
+            for (auto iter = mFinished.rbegin(); iter != mFinished.rend(); ++iter) {
+                RemoveAt(*iter);
+            }
+        }
+    };
+
+    // Running tweens of one value type, one set of lanes per easing so each is evaluated without a per-tween dispatch
+    template <typename T>
+    class TweenTrack {
+    private:
+        std::array<TweenLanes<T>, static_cast<size_t>(Easing::Custom) + 1> mLanes;
+
+        TweenLanes<T>& GetLanes(Easing easing) {
+            return mLanes[static_cast<size_t>(easing)];
+        }
+
+    public:
+        size_t GetSize() const {
+            size_t size = 0;
+
+            for (const TweenLanes<T>& lanes : mLanes) {
+                size += lanes.GetSize();
+            }
+
+            return size;
+        }
+
+        bool Start(Tween<T>&& tween, const std::shared_ptr<AnimationGroup>& group, float start) {
+            std::shared_ptr<Animatable> owner = tween.mTarget.lock();
+
+            if (owner == nullptr) {
+                return false;
+            }
+
+            owner->OnTweenStarted();
+
+            GetLanes(tween.mEasing.GetKind()).Start(std::move(tween), owner.get(), group, start);
+
+            return true;
+        }
+
+        void Rebase(float shift) {
+            for (TweenLanes<T>& lanes : mLanes) {
+                lanes.Rebase(shift);
+            }
+        }
+
+        void Clear() {
+            for (TweenLanes<T>& lanes : mLanes) {
+                lanes.Clear();
+            }
+        }
+
+        void Advance(TweenFrame& frame, bool is_tabulated) {
+            float now = frame.mNow;
+
+            GetLanes(Easing::Linear).template Evaluate<Easing::Linear>(now, is_tabulated);
+            GetLanes(Easing::InQuad).template Evaluate<Easing::InQuad>(now, is_tabulated);
+            GetLanes(Easing::OutQuad).template Evaluate<Easing::OutQuad>(now, is_tabulated);
+            GetLanes(Easing::InOutCubic).template Evaluate<Easing::InOutCubic>(now, is_tabulated);
+            GetLanes(Easing::InBounce).template Evaluate<Easing::InBounce>(now, is_tabulated);
+            GetLanes(Easing::OutBounce).template Evaluate<Easing::OutBounce>(now, is_tabulated);
+            GetLanes(Easing::OutElastic).template Evaluate<Easing::OutElastic>(now, is_tabulated);
+            GetLanes(Easing::Custom).template Evaluate<Easing::Custom>(now, is_tabulated);
+
+            for (TweenLanes<T>& lanes : mLanes) {
+                lanes.Apply(frame);
+            }
+        }
+    };
+
+    // Running springs of one value type, in parallel float arrays like TweenLanes. Every frame integrates all of them
+    // by the same number of fixed steps, so the cost only depends on how many run, and a dragged card that keeps
+    // getting new targets finds its spring through the index instead of starting a new one.
+    template <typename T>
+    class SpringTrack {
+    private:
+        static constexpr size_t Channels = TweenChannels<T>::Count;
+
+        struct Target {
+            std::weak_ptr<Animatable> mOwner; // only checked for expiry, applied through mObject
+            Animatable*               mObject     = nullptr;
+            TweenProperty             mProperty   = TweenProperty::Position;
+            uint32_t                  mGeneration = 0;
+
+            std::shared_ptr<AnimationGroup> mGroup; // empty for springs outside of any panel
+        };
+
+        struct Key {
+            const Animatable* mObject   = nullptr;
+            TweenProperty     mProperty = TweenProperty::Position;
+
+            bool operator==(const Key&) const = default;
+        };
+
+        struct KeyHash {
+            size_t operator()(const Key& key) const {
+                return std::hash<const void*>()(key.mObject) ^ static_cast<size_t>(key.mProperty);
+            }
+        };
+
+        std::vector<Target>                        mTargets;
+        std::vector<float>                         mStiffnesses;
+        std::vector<float>                         mDampings;
+        std::vector<float>                         mPrecisions;
+        std::vector<float>                         mSteps; // seconds per step, 0 while held by a suspended group
+        std::array<std::vector<float>, Channels>   mValues;
+        std::array<std::vector<float>, Channels>   mVelocities;
+        std::array<std::vector<float>, Channels>   mGoals;
+        std::vector<std::function<void()>>         mOnCompletes;
+        std::unordered_map<Key, uint32_t, KeyHash> mIndices;
+
+        // Scratch reused every frame
+        std::vector<uint32_t> mFinished;
+
+        void RemoveAt(size_t index) {
+            size_t last = mTargets.size() - 1;
+
+            mIndices.erase({mTargets[index].mObject, mTargets[index].mProperty});
+
+            if (mTargets[index].mGroup != nullptr) {
+                --mTargets[index].mGroup->mActiveTweens;
+            }
+
+            if (index != last) {
+                mTargets[index]     = std::move(mTargets[last]);
+                mStiffnesses[index] = mStiffnesses[last];
+                mDampings[index]    = mDampings[last];
+                mPrecisions[index]  = mPrecisions[last];
+                mSteps[index]       = mSteps[last];
+                mOnCompletes[index] = std::move(mOnCompletes[last]);
+
+                for (size_t c = 0; c < Channels; ++c) {
+                    mValues[c][index]     = mValues[c][last];
+                    mVelocities[c][index] = mVelocities[c][last];
+                    mGoals[c][index]      = mGoals[c][last];
+                }
+
+                mIndices[{mTargets[index].mObject, mTargets[index].mProperty}] = static_cast<uint32_t>(index);
+            }
+
+            mTargets.pop_back();
+            mStiffnesses.pop_back();
+            mDampings.pop_back();
+            mPrecisions.pop_back();
+            mSteps.pop_back();
+            mOnCompletes.pop_back();
+
+            for (size_t c = 0; c < Channels; ++c) {
+                mValues[c].pop_back();
+                mVelocities[c].pop_back();
+                mGoals[c].pop_back();
+            }
+        }
+
+        bool IsSettled(size_t index) const {
+            float precision = mPrecisions[index];
+
+            for (size_t c = 0; c < Channels; ++c) {
+                if (precision < std::abs(mGoals[c][index] - mValues[c][index]) || precision < std::abs(mVelocities[c][index])) {
+                    return false;
+                }
+            }
+
+            return true;
+        }
+
+        void Snap(size_t index) {
+            for (size_t c = 0; c < Channels; ++c) {
+                mValues[c][index]     = mGoals[c][index];
+                mVelocities[c][index] = 0.0f;
+            }
+        }
+
+        // Semi-implicit Euler, stable as long as a step stays well under the spring's period
+        void Integrate(uint32_t steps) {
+            size_t count = mTargets.size();
+            size_t i     = 0;
+
+            for (; i + Simd::Width <= count; i += Simd::Width) {
+                Simd::Batch stiffness = Simd::Load(&mStiffnesses[i]);
+                Simd::Batch damping   = Simd::Load(&mDampings[i]);
+                Simd::Batch step      = Simd::Load(&mSteps[i]);
+
+                for (size_t c = 0; c < Channels; ++c) {
+                    Simd::Batch value    = Simd::Load(&mValues[c][i]);
+                    Simd::Batch velocity = Simd::Load(&mVelocities[c][i]);
+                    Simd::Batch goal     = Simd::Load(&mGoals[c][i]);
+
+                    for (uint32_t s = 0; s < steps; ++s) {
+                        velocity = velocity + (stiffness * (goal - value) - damping * velocity) * step;
+                        value    = value + velocity * step;
+                    }
+
+                    Simd::Store(&mValues[c][i], value);
+                    Simd::Store(&mVelocities[c][i], velocity);
+                }
+            }
+
+            for (; i < count; ++i) {
+                for (size_t c = 0; c < Channels; ++c) {
+                    float value    = mValues[c][i];
+                    float velocity = mVelocities[c][i];
+
+                    for (uint32_t s = 0; s < steps; ++s) {
+                        velocity += (mStiffnesses[i] * (mGoals[c][i] - value) - mDampings[i] * velocity) * mSteps[i];
+                        value    += velocity * mSteps[i];
+                    }
+
+                    mValues[c][i]     = value;
+                    mVelocities[c][i] = velocity;
+                }
+            }
+        }
+
+    public:
+        size_t GetSize() const {
+            return mTargets.size();
+        }
+
+        // Returns false for a request whose target is gone or that a later tween or cancel superseded
+        bool Start(Spring<T>&& spring, const std::shared_ptr<AnimationGroup>& group) {
+            std::shared_ptr<Animatable> owner = spring.mTarget.lock();
+
+            if (owner == nullptr || owner->GetTweenGeneration(spring.mProperty) != spring.mGeneration) {
+                return false;
+            }
+
+            Animatable*                 object = owner.get();
+            std::array<float, Channels> goal   = TweenChannels<T>::Split(spring.mTo);
+            auto                        iter   = mIndices.find({object, spring.mProperty});
+
+            if (iter != mIndices.end()) {
+                uint32_t index  = iter->second;
+                Target&  target = mTargets[index];
+
+                // Still running, heads for the new target from wherever it is now
+                if (target.mOwner.expired() == false && target.mGeneration == spring.mGeneration) {
+                    if (target.mGroup != nullptr) {
+                        --target.mGroup->mActiveTweens;
+                    }
+
+                    if (group != nullptr) {
+                        ++group->mActiveTweens;
+                    }
+
+                    target.mGroup = group;
+
+                    mStiffnesses[index] = spring.mParams.mStiffness;
+                    mDampings[index]    = spring.mParams.GetDamping();
+                    mPrecisions[index]  = spring.mParams.mPrecision;
+                    mOnCompletes[index] = std::move(spring.mOnComplete);
+
+                    for (size_t c = 0; c < Channels; ++c) {
+                        mGoals[c][index] = goal[c];
+                    }
+
+                    return true;
+                }
+
+                if (target.mOwner.expired() == false) {
+                    target.mObject->OnTweenEnded();
+                }
+
+                RemoveAt(index);
+            }
+
+            std::array<float, Channels> from = TweenChannels<T>::Split(spring.mFrom);
+
+            object->OnTweenStarted();
+
+            if (group != nullptr) {
+                ++group->mActiveTweens;
+            }
+
+            mIndices[{object, spring.mProperty}] = static_cast<uint32_t>(mTargets.size());
+
+            mTargets.push_back({std::move(spring.mTarget), object, spring.mProperty, object->BeginTween(spring.mProperty), group});
+            mStiffnesses.push_back(spring.mParams.mStiffness);
+            mDampings.push_back(spring.mParams.GetDamping());
+            mPrecisions.push_back(spring.mParams.mPrecision);
+            mSteps.push_back(0.0f);
+            mOnCompletes.push_back(std::move(spring.mOnComplete));
+
+            for (size_t c = 0; c < Channels; ++c) {
+                mValues[c].push_back(from[c]);
+                mVelocities[c].push_back(0.0f);
+                mGoals[c].push_back(goal[c]);
+            }
+
+            return true;
+        }
+
+        void Clear() {
+            for (const Target& target : mTargets) {
+                if (target.mOwner.expired() == false) {
+                    target.mObject->OnTweenEnded();
+                }
+
+                if (target.mGroup != nullptr) {
+                    --target.mGroup->mActiveTweens;
+                }
+            }
+
+            mTargets.clear();
+            mStiffnesses.clear();
+            mDampings.clear();
+            mPrecisions.clear();
+            mSteps.clear();
+            mOnCompletes.clear();
+            mIndices.clear();
+
+            for (size_t c = 0; c < Channels; ++c) {
+                mValues[c].clear();
+                mVelocities[c].clear();
+                mGoals[c].clear();
+            }
+        }
+
+        // Integrates every spring by the given number of fixed steps, then writes the values like TweenLanes::Apply().
+        // Suspended groups follow their policy: Pause holds the spring, FastForward lands it on its target once
+        // shown, and Run keeps integrating without writing until it settles.
+        void Advance(TweenFrame& frame, uint32_t steps, float step) {
+            for (size_t i = 0; i < mTargets.size(); ++i) {
+                const Target& target = mTargets[i];
+
+                bool is_held = target.mGroup != nullptr && target.mGroup->mIsSuspended == true && target.mGroup->mPolicy != SuspendPolicy::Run;
+
+                mSteps[i] = is_held == true ? 0.0f : step;
+
+                if (is_held == true && target.mGroup->mPolicy == SuspendPolicy::FastForward) {
+                    Snap(i);
+                }
+            }
+
+            Integrate(steps);
+
+            mFinished.clear();
+
+            for (uint32_t i = 0; i < mTargets.size(); ++i) {
+                Target& target = mTargets[i];
+
+                if (target.mOwner.expired() == true) {
+                    mFinished.push_back(i);
+
+                    continue;
+                }
+
+                // Superseded or cancelled since it started
+                if (target.mObject->GetTweenGeneration(target.mProperty) != target.mGeneration) {
+                    target.mObject->OnTweenEnded();
+                    mFinished.push_back(i);
+
+                    continue;
+                }
+
+                bool is_final = IsSettled(i);
+
+                if (target.mGroup != nullptr && target.mGroup->mIsSuspended == true) {
+                    if (target.mGroup->mPolicy != SuspendPolicy::Run) {
+                        continue;
+                    }
+
+                    // No end time to wake up for, so it keeps frames coming while it moves
+                    if (is_final == false) {
+                        ++frame.mRunning;
+
+                        continue;
+                    }
+                }
+
+                if (is_final == true) {
+                    Snap(i);
+                }
+
+                bool is_applied = target.mObject->ApplyTween(target.mProperty, TweenChannels<T>::Join(mValues, i));
+
+                if (is_applied == false || is_final == true) {
+                    target.mObject->OnTweenEnded();
+                    mFinished.push_back(i);
+
+                    if (is_applied == true && mOnCompletes[i]) {
+                        frame.mCompletions.push_back(std::move(mOnCompletes[i]));
+                    }
+
+                    continue;
+                }
+
+                ++frame.mRunning;
+            }
+
+            for (auto iter = mFinished.rbegin(); iter != mFinished.rend(); ++iter) {
+                RemoveAt(*iter);
+            }
+        }
+    };
+
+    // Owns every running tween of a context. The clock is read once per frame by the caller and handed to Advance(),
+    // tweens live in dense arrays per value type, and completion callbacks run together after all values are written.
+    class AnimationScheduler {
+    private:
+        TweenTrack<sf::Vector2f>  mVectors;
+        TweenTrack<sf::Color>     mColors;
+        TweenTrack<float>         mFloats;
+        SpringTrack<sf::Vector2f> mSprings;
+        float                     mSpringTime = 0.0f; // elapsed time the springs haven't been stepped through yet
+
+        std::vector<std::shared_ptr<Timeline>> mTimelines; // playing ones, dropped once they stop
+        ChangeCounter                          mChanges;   // timelines started, which wakes an idle event-driven context
+
+        std::shared_ptr<AnimationGroup> mGroup; // given to submitted tweens, see AnimationGroupScope
+        TweenFrame                      mFrame; // reused every frame
+        size_t                          mRunning = 0;
+
+        std::chrono::steady_clock::time_point mFrameTime;
+        std::chrono::steady_clock::time_point mEpoch; // tween times are float seconds from here
+        bool                                  mIsTabulated = true;
+
+        // Past this, the epoch moves up to keep float seconds precise to well under a frame
+        static constexpr float RebaseSeconds = 1024.0f;
+
+        // Springs move in fixed steps whatever the frame rate; past the cap a stalled frame slows them down instead
+        static constexpr float    SpringStep     = 1.0f / 240.0f;
+        static constexpr uint32_t MaxSpringSteps = 32;
+
+        float ToSeconds(std::chrono::steady_clock::time_point time) const {
+            return std::chrono::duration<float>(time - mEpoch).count();
+        }
+
+        template <typename T>
+        void SubmitAll(std::vector<Tween<T>>& tweens, TweenTrack<T>& track, const std::shared_ptr<Animatable>& owner) {
+            for (Tween<T>& tween : tweens) {
+                if (tween.mObject == owner.get()) {
+                    tween.mTarget = owner;
+                }
+
+                bool is_started = track.Start(std::move(tween), mGroup, ToSeconds(mFrameTime));
+
+                if (is_started == true && (mGroup == nullptr || mGroup->mIsSuspended == false)) {
+                    ++mRunning;
+                }
+            }
+
+            tweens.clear();
+        }
+
+        void SubmitSprings(std::vector<Spring<sf::Vector2f>>& springs, const std::shared_ptr<Animatable>& owner) {
+            for (Spring<sf::Vector2f>& spring : springs) {
+                if (spring.mObject == owner.get()) {
+                    spring.mTarget = owner;
+                }
+
+                bool is_started = mSprings.Start(std::move(spring), mGroup);
+
+                if (is_started == true && (mGroup == nullptr || mGroup->mIsSuspended == false)) {
+                    ++mRunning;
+                }
+            }
+
+            springs.clear();
+        }
+
+    public:
+        AnimationScheduler() : mFrameTime(std::chrono::steady_clock::now()), mEpoch(mFrameTime) {};
+
+        size_t GetSize() const {
+            return mVectors.GetSize() + mColors.GetSize() + mFloats.GetSize() + mSprings.GetSize() + mTimelines.size();
+        }
+
+        bool IsEmpty() const {
+            return GetSize() == 0;
+        }
+
+        // Whether the next frame writes values; suspended tweens only need one at GetNextDeadline()
+        bool IsRunning() const {
+            return 0 < mRunning || mTimelines.empty() == false;
+        }
+
+        // When the first suspended tween that keeps time runs out, after the last Advance()
+        std::optional<std::chrono::steady_clock::time_point> GetNextDeadline() const {
+            if (mFrame.mNextEnd.has_value() == false) {
+                return std::nullopt;
+            }
+
+            return mEpoch + std::chrono::duration_cast<std::chrono::steady_clock::duration>(std::chrono::duration<float>(mFrame.mNextEnd.value()));
+        }
+
+        const std::shared_ptr<AnimationGroup>& GetGroup() const {
+            return mGroup;
+        }
+
+        void SetGroup(std::shared_ptr<AnimationGroup> group) {
+            mGroup = std::move(group);
+        }
+
+        // Time of the current frame; tweens submitted during it begin here
+        std::chrono::steady_clock::time_point GetFrameTime() const {
+            return mFrameTime;
+        }
+
+        void SetFrameTime(std::chrono::steady_clock::time_point now) {
+            mFrameTime = now;
+        }
+
+        bool IsTabulated() const {
+            return mIsTabulated;
+        }
+
+        // Evaluate pow/sin-based easings from precomputed tables, within about 1e-3 of the exact curve
+        void SetTabulated(bool is_tabulated) {
+            mIsTabulated = is_tabulated;
+        }
+
+        // Starts everything the owner requested; tweens on the owner itself are bound to the given pointer,
+        // which for batch widgets is the only one keeping them alive
+        void Submit(TweenQueue& queue, const std::shared_ptr<Animatable>& owner) {
+            if (queue.IsEmpty() == true) {
+                return;
+            }
+
+            SubmitAll(queue.Get<sf::Vector2f>(), mVectors, owner);
+            SubmitAll(queue.Get<sf::Color>(), mColors, owner);
+            SubmitAll(queue.Get<float>(), mFloats, owner);
+            SubmitSprings(queue.GetSprings(), owner);
+        }
+
+        uint64_t GetChangeCount() const {
+            return mChanges.Get();
+        }
+
+        // Starts or resumes a timeline from its playhead; one that already finished starts over.
+        // Playback counts from start, the time of the clock in scope unless given, not from the last frame.
+        void Play(const std::shared_ptr<Timeline>& timeline, std::chrono::steady_clock::time_point start = Clock::GetNow()) {
+            timeline->Begin(start);
+
+            if (std::find(mTimelines.begin(), mTimelines.end(), timeline) == mTimelines.end()) {
+                mTimelines.push_back(timeline);
+            }
+
+            mChanges.Bump();
+        }
+
+        void Clear() {
+            mVectors.Clear();
+            mColors.Clear();
+            mFloats.Clear();
+            mSprings.Clear();
+
+            for (auto& timeline : mTimelines) {
+                timeline->Pause();
+            }
+
+            mTimelines.clear();
+
+            mRunning    = 0;
+            mSpringTime = 0.0f;
+            mFrame.mNextEnd.reset();
+        }
+
+        // Writes every tween's value for this frame, then runs the callbacks of those that finished
+        void Advance(std::chrono::steady_clock::time_point now) {
+            float delta = std::max(std::chrono::duration<float>(now - mFrameTime).count(), 0.0f);
+
+            mFrameTime = now;
+
+            float now_seconds = ToSeconds(now);
+
+            if (RebaseSeconds < std::abs(now_seconds)) {
+                mVectors.Rebase(now_seconds);
+                mColors.Rebase(now_seconds);
+                mFloats.Rebase(now_seconds);
+
+                mEpoch      = now;
+                now_seconds = 0.0f;
+            }
+
+            mFrame.mNow     = now_seconds;
+            mFrame.mDelta   = delta;
+            mFrame.mRunning = 0;
+            mFrame.mNextEnd.reset();
+
+            mVectors.Advance(mFrame, mIsTabulated);
+            mColors.Advance(mFrame, mIsTabulated);
+            mFloats.Advance(mFrame, mIsTabulated);
+
+            if (0 < mSprings.GetSize()) {
+                mSpringTime += delta;
+
+                uint32_t steps = static_cast<uint32_t>(mSpringTime / SpringStep);
+
+                mSpringTime -= static_cast<float>(steps) * SpringStep;
+
+                mSprings.Advance(mFrame, std::min(steps, MaxSpringSteps), SpringStep);
+            }
+            else {
+                mSpringTime = 0.0f;
+            }
+
+            std::erase_if(mTimelines, [&](const std::shared_ptr<Timeline>& timeline) { return timeline->Advance(now, mFrame.mCompletions) == false; });
+
+            mRunning = mFrame.mRunning;
+
+            // Last, since callbacks commonly request the next animation
+            for (auto& callback : mFrame.mCompletions) {
+                callback();
+            }
+
+            mFrame.mCompletions.clear();
+        }
+    };
+
+    // Tweens submitted while in scope belong to the group, restoring the previous one afterwards
+    class AnimationGroupScope {
+    private:
+        AnimationScheduler&             mScheduler;
+        std::shared_ptr<AnimationGroup> mPrevious;
+
+    public:
+        AnimationGroupScope(AnimationScheduler& scheduler, std::shared_ptr<AnimationGroup> group) : mScheduler(scheduler), mPrevious(scheduler.GetGroup()) {
+            mScheduler.SetGroup(std::move(group));
+        }
+
+        ~AnimationGroupScope() {
+            mScheduler.SetGroup(std::move(mPrevious));
+        }
+
+        AnimationGroupScope(const AnimationGroupScope&)            = delete;
+        AnimationGroupScope& operator=(const AnimationGroupScope&) = delete;
+    };
+} // namespace Orbis
\ No newline at end of file
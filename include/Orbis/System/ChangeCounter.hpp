@@ -0,0 +1,38 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+
+namespace Orbis {
+    // Count of visible UI mutations, owned by whatever groups them: a panel, a scene, a container's children.
+    // A bump carries on to the parent, and a context compares the counters of its own panels and scenes
+    // against the values seen at its last update to tell whether a frame can be skipped.
+    class ChangeCounter {
+    private:
+        std::atomic<uint64_t>          mCount = 0;
+        std::shared_ptr<ChangeCounter> mParent;
+
+    public:
+        ChangeCounter() = default;
+
+        ChangeCounter(const ChangeCounter&)            = delete;
+        ChangeCounter& operator=(const ChangeCounter&) = delete;
+
+        uint64_t Get() const {
+            return mCount.load(std::memory_order_relaxed);
+        }
+
+        void Bump() {
+            mCount.fetch_add(1, std::memory_order_relaxed);
+
+            if (mParent != nullptr) {
+                mParent->Bump();
+            }
+        }
+
+        void SetParent(std::shared_ptr<ChangeCounter> parent) {
+            mParent = std::move(parent);
+        }
+    };
+} // namespace Orbis
\ No newline at end of file
@@ -0,0 +1,187 @@
+#pragma once
+
+#include <chrono>
+#include <optional>
+
+#include "Orbis/System/Enums.hpp"
+
+namespace Orbis {
+    // Time source of a context. Ticked once per frame, and read through GetNow() by everything that animates,
+    // so pausing, slowing down or stepping it applies to the whole UI at once.
+    // Times stay on steady_clock's timeline, a realtime clock starts out equal to steady_clock::now().
+    class Clock {
+    public:
+        using TimePoint = std::chrono::steady_clock::time_point;
+        using Duration  = std::chrono::steady_clock::duration;
+
+    private:
+        ClockMode mMode     = ClockMode::Realtime;
+        TimePoint mNow      = std::chrono::steady_clock::now();
+        TimePoint mRealLast = mNow; // wall time of the last tick
+        float     mScale    = 1.0f;
+        float     mStep     = 1.0f / 60.0f;
+        bool      mIsPaused = false;
+
+        static Clock*& GetCurrentSlot() {
+            thread_local Clock* current = nullptr;
+
+            return current;
+        }
+
+        // Math stays in double ticks, a float can't hold a steady_clock span past a few seconds to the nanosecond
+        static Duration ToDuration(double seconds) {
+            return std::chrono::duration_cast<Duration>(std::chrono::duration<double>(seconds));
+        }
+
+        static Duration Scale(Duration duration, double scale) {
+            return std::chrono::duration_cast<Duration>(std::chrono::duration<double, Duration::period>(duration) * scale);
+        }
+
+        TimePoint GetNext(TimePoint real_now) const {
+            if (mIsPaused == true) {
+                return mNow;
+            }
+
+            switch (mMode) {
+                case ClockMode::Realtime: {
+                    return mNow + Scale(real_now - mRealLast, mScale);
+                }
+                case ClockMode::FixedStep: {
+                    return mNow + ToDuration(static_cast<double>(mStep) * mScale);
+                }
+                default: {
+                    return mNow;
+                }
+            }
+        }
+
+    public:
+        Clock() = default;
+
+        Clock(ClockMode mode) : mMode(mode) {};
+
+        // Frame time of the clock bound to this thread by a ClockScope, steady_clock::now() outside of one
+        static TimePoint GetNow() {
+            Clock* current = GetCurrentSlot();
+
+            return current != nullptr ? current->mNow : std::chrono::steady_clock::now();
+        }
+
+        static Clock* GetCurrent() {
+            return GetCurrentSlot();
+        }
+
+        ClockMode GetMode() const {
+            return mMode;
+        }
+
+        TimePoint GetTime() const {
+            return mNow;
+        }
+
+        float GetScale() const {
+            return mScale;
+        }
+
+        float GetFixedStep() const {
+            return mStep;
+        }
+
+        bool IsPaused() const {
+            return mIsPaused;
+        }
+
+        Clock& SetMode(ClockMode mode) {
+            mMode     = mode;
+            mRealLast = std::chrono::steady_clock::now();
+
+            return *this;
+        }
+
+        // Multiplies realtime and fixed-step progress; 0.25f is quarter-speed slow motion
+        Clock& SetScale(float scale) {
+            mScale = scale;
+
+            return *this;
+        }
+
+        Clock& SetFixedStep(float seconds) {
+            mStep = seconds;
+
+            return *this;
+        }
+
+        Clock& SetPaused(bool is_paused) {
+            mIsPaused = is_paused;
+            mRealLast = std::chrono::steady_clock::now();
+
+            return *this;
+        }
+
+        // Moves time forward in any mode, e.g. from a game's simulation step
+        Clock& Advance(float seconds) {
+            mNow += ToDuration(seconds);
+
+            return *this;
+        }
+
+        Clock& SetTime(TimePoint time) {
+            mNow = time;
+
+            return *this;
+        }
+
+        // What the next Tick() would return, without committing to it
+        TimePoint Peek() const {
+            return GetNext(std::chrono::steady_clock::now());
+        }
+
+        // Frame time while bound to this thread, i.e. during the frame; between frames, where the next Tick() would land
+        TimePoint GetCurrentTime() const {
+            return GetCurrentSlot() == this ? mNow : Peek();
+        }
+
+        TimePoint Tick() {
+            TimePoint real_now = std::chrono::steady_clock::now();
+
+            mNow      = GetNext(real_now);
+            mRealLast = real_now;
+
+            return mNow;
+        }
+
+        // Wall time at which clock time reaches the given point, empty when that can't be predicted.
+        // A fixed-step clock gets there by ticking, so it's due right away.
+        std::optional<TimePoint> ToWallTime(TimePoint time) const {
+            if (mIsPaused == true || mMode == ClockMode::Manual || (mMode == ClockMode::Realtime && mScale <= 0.0f)) {
+                return std::nullopt;
+            }
+
+            if (mMode == ClockMode::FixedStep || time <= mNow) {
+                return mRealLast;
+            }
+
+            return mRealLast + Scale(time - mNow, 1.0 / mScale);
+        }
+
+        friend class ClockScope;
+    };
+
+    // Binds a clock to the current thread for the lifetime of the scope, restoring the previous one afterwards
+    class ClockScope {
+    private:
+        Clock* mPrevious;
+
+    public:
+        ClockScope(Clock& clock) : mPrevious(Clock::GetCurrentSlot()) {
+            Clock::GetCurrentSlot() = &clock;
+        }
+
+        ~ClockScope() {
+            Clock::GetCurrentSlot() = mPrevious;
+        }
+
+        ClockScope(const ClockScope&)            = delete;
+        ClockScope& operator=(const ClockScope&) = delete;
+    };
+} // namespace Orbis
\ No newline at end of file
@@ -1,11 +1,131 @@
 #pragma once
 
+#include <array>
+#include <chrono>
 #include <vector>
 
 #include <SFML/Graphics.hpp>
 #include <SFML/System.hpp>
 
+#include "Orbis/System/Enums.hpp"
+
 namespace Orbis {
+    struct InputEvent {
+        InputType                             mType = InputType::MouseMoved;
+        std::chrono::steady_clock::time_point mTime;
+
+        sf::Vector2f      mPosition   = {0, 0}; // pointer position when the event happened
+        sf::Mouse::Button mButton     = sf::Mouse::Button::Left;
+        sf::Keyboard::Key mKey        = sf::Keyboard::Key::Unknown;
+        char32_t          mUnicode    = 0;
+        float             mWheelDelta = 0.0f;
+
+        bool mIsCPressed = false; // Control
+        bool mIsSPressed = false; // Shift
+        bool mIsAPressed = false; // Alt
+    };
+
+    // Fixed-capacity ring of one frame's input, in arrival order. Never allocates.
+    // When full, a move replaces a trailing move, anything else evicts the oldest event.
+    class InputQueue {
+    public:
+        static constexpr size_t Capacity = 256;
+
+        class Iterator {
+        private:
+            const InputQueue* mQueue;
+            size_t            mIndex;
+
+        public:
+            Iterator(const InputQueue* queue, size_t index) : mQueue(queue), mIndex(index) {};
+
+            const InputEvent& operator*() const {
+                return (*mQueue)[mIndex];
+            }
+
+            Iterator& operator++() {
+                ++mIndex;
+
+                return *this;
+            }
+
+            bool operator!=(const Iterator& other) const {
+                return mIndex != other.mIndex;
+            }
+        };
+
+    private:
+        std::array<InputEvent, Capacity> mEvents;
+        size_t                           mHead  = 0;
+        size_t                           mCount = 0;
+
+    public:
+        InputQueue() = default;
+
+        InputQueue(const InputQueue& other) {
+            *this = other;
+        }
+
+        // Copies only the live events, unwrapped to the front of the ring
+        InputQueue& operator=(const InputQueue& other) {
+            if (this == &other) {
+                return *this;
+            }
+
+            for (size_t i = 0; i < other.mCount; ++i) {
+                mEvents[i] = other[i];
+            }
+
+            mHead  = 0;
+            mCount = other.mCount;
+
+            return *this;
+        }
+
+        size_t GetSize() const {
+            return mCount;
+        }
+
+        bool IsEmpty() const {
+            return mCount == 0;
+        }
+
+        const InputEvent& operator[](size_t index) const {
+            return mEvents[(mHead + index) % Capacity];
+        }
+
+        Iterator begin() const {
+            return Iterator(this, 0);
+        }
+
+        Iterator end() const {
+            return Iterator(this, mCount);
+        }
+
+        void Push(const InputEvent& event) {
+            if (mCount == Capacity) {
+                InputEvent& last = mEvents[(mHead + mCount - 1) % Capacity];
+
+                if (last.mType == InputType::MouseMoved && event.mType == InputType::MouseMoved) {
+                    last = event;
+
+                    return;
+                }
+
+                mHead = (mHead + 1) % Capacity;
+                mCount--;
+            }
+
+            mEvents[(mHead + mCount) % Capacity] = event;
+            mCount++;
+        }
+
+        void Clear() {
+            mHead  = 0;
+            mCount = 0;
+        }
+    };
+
     struct Mouse {
         bool mIsLPressed  = false; // Left
         bool mIsRPressed  = false; // Right
@@ -14,12 +134,16 @@ namespace Orbis {
         bool mIsE2Pressed = false; // Extra2
         bool mIsScrolling = false;
 
-        sf::Vector2f mPosition = {0, 0};
+        sf::Vector2f mPosition   = {0, 0};
+        float        mWheelDelta = 0.0f; // summed over the frame, positive away from the user
 
         std::vector<sf::Mouse::Button> mButtonsPressed;
         std::vector<sf::Mouse::Button> mButtonsReleased;
 
         void ClearFrameEvents() {
+            mIsScrolling = false;
+            mWheelDelta  = 0.0f;
+
             mButtonsPressed.clear();
             mButtonsReleased.clear();
         }
@@ -51,7 +175,14 @@ namespace Orbis {
 
     class Controls {
     public:
-        Mouse    mMouse;
-        Keyboard mKeyboard;
+        Mouse      mMouse;
+        Keyboard   mKeyboard;
+        InputQueue mEvents;
+
+        void ClearFrameEvents() {
+            mMouse.ClearFrameEvents();
+            mKeyboard.ClearFrameEvents();
+            mEvents.Clear();
+        }
     };
 } // namespace Orbis
\ No newline at end of file
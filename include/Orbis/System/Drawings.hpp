@@ -1,10 +1,18 @@
 #pragma once
 
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <memory>
 #include <optional>
 #include <string>
+#include <vector>
 
 #include <SFML/Graphics.hpp>
 
+#include "Orbis/System/Animatable.hpp"
+#include "Orbis/System/ChangeCounter.hpp"
+#include "Orbis/System/Clock.hpp"
 #include "Orbis/System/Enums.hpp"
 
 namespace Orbis {
@@ -14,8 +22,9 @@ namespace Orbis {
     class DrawingsText;
     class DrawingsWText;
     class DrawingsTexture;
+    class DrawingsSprite;
 
-    class Drawings {
+    class Drawings : public Animatable {
     public:
         DrawingType  mType;
         std::string  mID;
@@ -23,13 +32,54 @@ namespace Orbis {
         size_t       mZLevel;
         sf::Color    mFillColor;
 
+        std::shared_ptr<ChangeCounter> mChanges; // the owning widget's, empty until it joins a panel
+
         virtual ~Drawings() = default;
+
+        void MarkChanged() {
+            if (mChanges != nullptr) {
+                mChanges->Bump();
+            }
+        }
+
+        static std::uint8_t ToAlpha(float alpha) {
+            return static_cast<std::uint8_t>(std::lround(std::clamp(alpha, 0.0f, 1.0f) * 255.0f));
+        }
+
+        using Animatable::ApplyTween;
+
+        bool ApplyTween(TweenProperty property, sf::Color value) override {
+            if (property != TweenProperty::FillColor) {
+                return false;
+            }
+
+            mFillColor = value;
+
+            MarkChanged();
+
+            return true;
+        }
+
+        bool ApplyTween(TweenProperty property, float value) override {
+            if (property != TweenProperty::Alpha) {
+                return false;
+            }
+
+            mFillColor.a = ToAlpha(value);
+
+            MarkChanged();
+
+            return true;
+        }
     };
 
+    // The mutable caches below keep SFML geometry alive between frames, so redrawing an unchanged drawing never allocates
+
     class DrawingsLine : public Drawings {
     public:
         std::vector<sf::Vector2f> mPoints;
         float                     mThickness;
+        mutable sf::VertexArray   mCachedVertices;
     };
 
     class DrawingsRect : public Drawings {
@@ -40,6 +90,43 @@ namespace Orbis {
         sf::Color    mOutlineColor;
         bool         mIsRounded;
         float        mRoundingRadius;
+
+        mutable std::optional<sf::RectangleShape> mCachedShape;
+        mutable std::optional<sf::ConvexShape>    mCachedRounded;
+        mutable sf::Vector2f                      mCachedRoundedSize   = {0, 0};
+        mutable float                             mCachedRoundedRadius = 0.0f;
+
+        bool ApplyTween(TweenProperty property, sf::Vector2f value) override {
+            if (property != TweenProperty::Size) {
+                return false;
+            }
+
+            mSize = value;
+
+            MarkChanged();
+
+            return true;
+        }
+
+        bool ApplyTween(TweenProperty property, sf::Color value) override {
+            if (property != TweenProperty::OutlineColor) {
+                return Drawings::ApplyTween(property, value);
+            }
+
+            mOutlineColor = value;
+
+            MarkChanged();
+
+            return true;
+        }
+
+        bool ApplyTween(TweenProperty property, float value) override {
+            if (property == TweenProperty::Alpha) {
+                mOutlineColor.a = ToAlpha(value);
+            }
+
+            return Drawings::ApplyTween(property, value);
+        }
     };
 
     class DrawingsText : public Drawings {
@@ -65,5 +152,136 @@ namespace Orbis {
         std::shared_ptr<sf::Texture> mTexture;
         sf::Vector2f                 mSize;
         sf::Vector2f                 mScale;
+
+        using Drawings::ApplyTween;
+
+        bool ApplyTween(TweenProperty property, sf::Vector2f value) override {
+            if (property != TweenProperty::Size) {
+                return false;
+            }
+
+            mSize = value;
+
+            MarkChanged();
+
+            return true;
+        }
+    };
+
+    // Frame sequence from an atlas region, frames laid out left to right and top to bottom. The shown frame is
+    // derived from the clock when drawn, so playing costs nothing per update; frames of one texture draw in one batch.
+    class DrawingsSprite : public Drawings {
+    public:
+        std::shared_ptr<sf::Texture>          mTexture;
+        sf::Vector2f                          mSize;
+        sf::IntRect                           mAtlas;
+        sf::Vector2i                          mFrameSize;
+        size_t                                mFrameCount;
+        float                                 mFramesPerSecond;
+        bool                                  mIsLooping;
+        bool                                  mIsPlaying;
+        size_t                                mFrame; // first frame played, shown while stopped
+
+        // The context clock's frame time is only known during a frame, inside its ClockScope. Started between
+        // frames, playback counts from the first frame time read during one instead of from the wall clock.
+        mutable std::chrono::steady_clock::time_point mStartTime; // clock time of mFrame
+        mutable std::chrono::steady_clock::time_point mShownTime; // last frame time read during a frame
+        mutable bool                                  mIsStartPending = false;
+
+        void LatchTime(std::chrono::steady_clock::time_point now) const {
+            if (Clock::GetCurrent() == nullptr) {
+                return;
+            }
+
+            if (mIsStartPending == true) {
+                mStartTime      = now;
+                mIsStartPending = false;
+            }
+
+            mShownTime = now;
+        }
+
+        // The frame time now during a frame, the next one read during a frame otherwise
+        void AnchorStart() {
+            mStartTime      = Clock::GetNow();
+            mIsStartPending = Clock::GetCurrent() == nullptr;
+        }
+
+        size_t GetFrame(std::chrono::steady_clock::time_point now) const {
+            LatchTime(now);
+
+            if (mFrameCount == 0) {
+                return 0;
+            }
+
+            if (mIsPlaying == false || mIsStartPending == true || mFramesPerSecond <= 0.0f || now <= mStartTime) {
+                return std::min(mFrame, mFrameCount - 1);
+            }
+
+            size_t steps = static_cast<size_t>(std::chrono::duration<float>(now - mStartTime).count() * mFramesPerSecond);
+
+            return mIsLooping == true ? (mFrame + steps) % mFrameCount : std::min(mFrame + steps, mFrameCount - 1);
+        }
+
+        // Empty once a sequence that doesn't loop shows its last frame
+        std::optional<std::chrono::steady_clock::time_point> GetNextFrameTime(std::chrono::steady_clock::time_point now) const {
+            LatchTime(now);
+
+            if (mIsPlaying == false || mIsStartPending == true || mFramesPerSecond <= 0.0f || mFrameCount < 2) {
+                return std::nullopt;
+            }
+
+            if (mIsLooping == false && GetFrame(now) == mFrameCount - 1) {
+                return std::nullopt;
+            }
+
+            float steps = now <= mStartTime ? 0.0f : std::floor(std::chrono::duration<float>(now - mStartTime).count() * mFramesPerSecond);
+
+            return mStartTime + std::chrono::duration_cast<std::chrono::steady_clock::duration>(std::chrono::duration<float>((steps + 1.0f) / mFramesPerSecond));
+        }
+
+        sf::IntRect GetFrameRect(size_t frame) const {
+            int columns = 0 < mFrameSize.x ? std::max(mAtlas.size.x / mFrameSize.x, 1) : 1;
+            int index   = static_cast<int>(frame);
+
+            return sf::IntRect({mAtlas.position.x + (index % columns) * mFrameSize.x, mAtlas.position.y + (index / columns) * mFrameSize.y}, mFrameSize);
+        }
+
+        // Restarts from the frame, on the current frame time of the context clock
+        DrawingsSprite& Play(size_t from_frame = 0) {
+            mFrame     = from_frame;
+            mIsPlaying = true;
+
+            AnchorStart();
+
+            MarkChanged();
+
+            return *this;
+        }
+
+        // Holds the frame currently shown, the one of the last frame when called between frames
+        DrawingsSprite& Stop() {
+            mFrame          = GetFrame(Clock::GetCurrent() != nullptr ? Clock::GetNow() : mShownTime);
+            mIsPlaying      = false;
+            mIsStartPending = false;
+
+            MarkChanged();
+
+            return *this;
+        }
+
+        using Drawings::ApplyTween;
+
+        bool ApplyTween(TweenProperty property, sf::Vector2f value) override {
+            if (property != TweenProperty::Size) {
+                return false;
+            }
+
+            mSize = value;
+
+            MarkChanged();
+
+            return true;
+        }
     };
 } // namespace Orbis
\ No newline at end of file
@@ -7,6 +7,7 @@ namespace Orbis {
         Text,
         WText,
         Texture,
+        Sprite,
     };
 
     enum class WidgetType {
@@ -15,6 +16,8 @@ namespace Orbis {
         Slider,
         TextboxSingle,
         TextboxMulti,
+        ScrollView,
+        LogConsole,
     };
 
     enum class ButtonState {
@@ -47,6 +50,58 @@ namespace Orbis {
         RightBottom,
     };
 
+    enum class InputType {
+        MouseMoved,
+        MousePressed,
+        MouseReleased,
+        MouseWheel,
+        KeyPressed,
+        KeyReleased,
+        TextEntered,
+    };
+
+    enum class ClockMode {
+        Realtime,  // follows steady_clock, times the scale
+        FixedStep, // advances by a fixed step every tick, however long the frame took
+        Manual,    // only moves through Advance() or SetTime()
+    };
+
+    enum class Easing {
+        Linear,
+        InQuad,
+        OutQuad,
+        InOutCubic,
+        InBounce,
+        OutBounce,
+        OutElastic,
+        Custom, // a caller-supplied function
+    };
+
+    enum class TweenProperty {
+        Position,     // widget or panel
+        Scale,        // every texture of a widget
+        Size,         // rect or texture drawing
+        FillColor,    // any drawing, the text color of texts
+        OutlineColor, // rect drawing
+        Alpha,        // fill and outline alpha of a drawing, 0 to 1
+        Value,        // slider
+        ScrollOffset, // scroll view
+        Count,
+    };
+
+    // What tweens of a hidden panel or inactive scene do until it's shown again
+    enum class SuspendPolicy {
+        Run,         // keep time without writing values; the current value lands on resume, the final one when done
+        Pause,       // stop time, resuming where they left off
+        FastForward, // hold, then jump to their targets and complete on resume
+    };
+
+    enum class TimelineLoop {
+        Once,     // stops at the end
+        Loop,     // starts over from the beginning
+        PingPong, // alternates forward and backward
+    };
+
     enum class CursorStyle {
         Line,
         Block,
@@ -0,0 +1,108 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+#include "Orbis/System/ChangeCounter.hpp"
+#include "Orbis/Widgets/Widget.hpp"
+
+namespace Orbis {
+    // Holds the single widget that receives keyboard input, and the Tab order of a context.
+    class FocusManager {
+    private:
+        std::weak_ptr<Widget>                     mFocused;
+        std::vector<std::weak_ptr<Widget>>        mOrder;
+        std::unordered_map<const Widget*, size_t> mOrderIndex;
+        uint64_t                                  mOrderRevision = UINT64_MAX;
+        ChangeCounter                             mChanges; // focus moves
+
+    public:
+        FocusManager() = default;
+
+        std::shared_ptr<Widget> GetFocused() const {
+            return mFocused.lock();
+        }
+
+        uint64_t GetChangeCount() const {
+            return mChanges.Get();
+        }
+
+        bool IsOrderStale(uint64_t revision) const {
+            return mOrderRevision != revision;
+        }
+
+        void ClearOrder() {
+            mOrder.clear();
+            mOrderIndex.clear();
+        }
+
+        void AppendOrder(const std::shared_ptr<Widget>& widget) {
+            if (mOrderIndex.contains(widget.get()) == true) {
+                return;
+            }
+
+            mOrderIndex[widget.get()] = mOrder.size();
+            mOrder.push_back(widget);
+        }
+
+        void SetOrderRevision(uint64_t revision) {
+            mOrderRevision = revision;
+        }
+
+        void SetFocus(const std::shared_ptr<Widget>& widget) {
+            std::shared_ptr<Widget> current = mFocused.lock();
+
+            if (current == widget) {
+                return;
+            }
+
+            if (current != nullptr) {
+                current->OnFocusChanged(false);
+            }
+
+            mFocused = widget;
+
+            if (widget != nullptr) {
+                widget->OnFocusChanged(true);
+            }
+
+            mChanges.Bump();
+        }
+
+        void ClearFocus() {
+            SetFocus(nullptr);
+        }
+
+        void FocusNext(bool is_reverse) {
+            if (mOrder.empty() == true) {
+                return;
+            }
+
+            size_t                  count   = mOrder.size();
+            size_t                  index   = is_reverse ? count - 1 : 0;
+            std::shared_ptr<Widget> current = mFocused.lock();
+
+            if (current != nullptr) {
+                auto iter = mOrderIndex.find(current.get());
+
+                if (iter != mOrderIndex.end()) {
+                    index = is_reverse ? (iter->second + count - 1) % count : (iter->second + 1) % count;
+                }
+            }
+
+            for (size_t step = 0; step < count; ++step) {
+                std::shared_ptr<Widget> candidate = mOrder[index].lock();
+
+                if (candidate != nullptr && candidate->GetVisibility() == true) {
+                    SetFocus(candidate);
+
+                    return;
+                }
+
+                index = is_reverse ? (index + count - 1) % count : (index + 1) % count;
+            }
+        }
+    };
+} // namespace Orbis
\ No newline at end of file
@@ -0,0 +1,140 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace Orbis {
+    // Editable text as one array with a hole at the last edit. Typing or deleting next to the previous edit only
+    // moves the hole's edge, so a keystroke costs the same in a short field and a long document; an edit elsewhere
+    // first moves the characters between the two positions.
+    class GapBuffer {
+    private:
+        std::vector<char32_t> mData;
+        size_t                mGapStart = 0;
+        size_t                mGapEnd   = 0;
+
+        static constexpr size_t MinGap = 64;
+
+        size_t GetGapSize() const {
+            return mGapEnd - mGapStart;
+        }
+
+        void MoveGap(size_t position) {
+            if (position < mGapStart) {
+                size_t count = mGapStart - position;
+
+                std::move_backward(mData.begin() + position, mData.begin() + mGapStart, mData.begin() + mGapEnd);
+
+                mGapStart -= count;
+                mGapEnd   -= count;
+            }
+            else if (mGapStart < position) {
+                size_t count = position - mGapStart;
+
+                std::move(mData.begin() + mGapEnd, mData.begin() + mGapEnd + count, mData.begin() + mGapStart);
+
+                mGapStart += count;
+                mGapEnd   += count;
+            }
+        }
+
+        // Grows geometrically, so a long paste typed in one character at a time stays linear overall
+        void Reserve(size_t count) {
+            if (count <= GetGapSize()) {
+                return;
+            }
+
+            size_t size     = GetSize();
+            size_t capacity = std::max({mData.size() * 2, size + count + MinGap, MinGap});
+            size_t tail     = mData.size() - mGapEnd;
+
+            std::vector<char32_t> data(capacity);
+
+            std::copy(mData.begin(), mData.begin() + mGapStart, data.begin());
+            std::copy(mData.begin() + mGapEnd, mData.end(), data.end() - tail);
+
+            mData   = std::move(data);
+            mGapEnd = mData.size() - tail;
+        }
+
+    public:
+        GapBuffer() = default;
+
+        GapBuffer(std::u32string_view text) {
+            Assign(text);
+        }
+
+        size_t GetSize() const {
+            return mData.size() - GetGapSize();
+        }
+
+        bool IsEmpty() const {
+            return GetSize() == 0;
+        }
+
+        char32_t operator[](size_t index) const {
+            return index < mGapStart ? mData[index] : mData[index + GetGapSize()];
+        }
+
+        void Assign(std::u32string_view text) {
+            mData.assign(text.begin(), text.end());
+            mData.resize(text.size() + MinGap);
+
+            mGapStart = text.size();
+            mGapEnd   = mData.size();
+        }
+
+        void Clear() {
+            mGapStart = 0;
+            mGapEnd   = mData.size();
+        }
+
+        void Insert(size_t position, std::u32string_view text) {
+            position = std::min(position, GetSize());
+
+            Reserve(text.size());
+            MoveGap(position);
+
+            std::copy(text.begin(), text.end(), mData.begin() + mGapStart);
+
+            mGapStart += text.size();
+        }
+
+        void Erase(size_t position, size_t count) {
+            position = std::min(position, GetSize());
+            count    = std::min(count, GetSize() - position);
+
+            MoveGap(position);
+
+            mGapEnd += count;
+        }
+
+        std::u32string Substring(size_t position, size_t count = std::u32string::npos) const {
+            position = std::min(position, GetSize());
+            count    = std::min(count, GetSize() - position);
+
+            std::u32string text;
+
+            text.reserve(count);
+
+            for (size_t i = position; i < position + count; ++i) {
+                text.push_back((*this)[i]);
+            }
+
+            return text;
+        }
+
+        std::u32string ToString() const {
+            std::u32string text;
+
+            text.reserve(GetSize());
+            text.append(mData.begin(), mData.begin() + mGapStart);
+            text.append(mData.begin() + mGapEnd, mData.end());
+
+            return text;
+        }
+    };
+} // namespace Orbis
\ No newline at end of file
@@ -0,0 +1,214 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include <SFML/Graphics.hpp>
+
+namespace Orbis {
+    // One line of text laid out the way sf::Text lays it out, kept as a quad per character. Edits splice the arrays
+    // and only look up glyphs for the characters they add, and drawing takes just the quads in a horizontal range,
+    // so neither depends on how long the line is beyond moving its tail along.
+    class GlyphRun {
+    private:
+        static constexpr size_t VerticesPerGlyph = 6;
+
+        std::shared_ptr<sf::Font> mFont;
+        unsigned int              mFontSize = 0;
+        sf::Color                 mColor    = sf::Color::White;
+
+        std::vector<float>      mAdvances; // per character, with the kerning to the one before
+        std::vector<float>      mCursorXs; // x of every position between characters, one more than characters
+        std::vector<sf::Vertex> mVertices; // in run space, the baseline at the font size like sf::Text
+
+        void WriteQuad(size_t index, char32_t code) {
+            sf::Vertex* quad = &mVertices[index * VerticesPerGlyph];
+            float       x    = mCursorXs[index];
+            float       y    = static_cast<float>(mFontSize);
+
+            // Whitespace keeps a degenerate quad, so vertices stay indexed by character
+            if (code == U' ' || code == U'\t' || code == U'\n') {
+                for (size_t v = 0; v < VerticesPerGlyph; ++v) {
+                    quad[v] = sf::Vertex{{x, y}, mColor, {0, 0}};
+                }
+
+                return;
+            }
+
+            const sf::Glyph& glyph   = mFont->getGlyph(code, mFontSize, false);
+            float            padding = 1.0f;
+
+            float left   = glyph.bounds.position.x - padding;
+            float top    = glyph.bounds.position.y - padding;
+            float right  = glyph.bounds.position.x + glyph.bounds.size.x + padding;
+            float bottom = glyph.bounds.position.y + glyph.bounds.size.y + padding;
+
+            float u1 = static_cast<float>(glyph.textureRect.position.x) - padding;
+            float v1 = static_cast<float>(glyph.textureRect.position.y) - padding;
+            float u2 = static_cast<float>(glyph.textureRect.position.x + glyph.textureRect.size.x) + padding;
+            float v2 = static_cast<float>(glyph.textureRect.position.y + glyph.textureRect.size.y) + padding;
+
+            quad[0] = sf::Vertex{{x + left, y + top}, mColor, {u1, v1}};
+            quad[1] = sf::Vertex{{x + right, y + top}, mColor, {u2, v1}};
+            quad[2] = sf::Vertex{{x + left, y + bottom}, mColor, {u1, v2}};
+            quad[3] = sf::Vertex{{x + left, y + bottom}, mColor, {u1, v2}};
+            quad[4] = sf::Vertex{{x + right, y + top}, mColor, {u2, v1}};
+            quad[5] = sf::Vertex{{x + right, y + bottom}, mColor, {u2, v2}};
+        }
+
+        template <typename Text>
+        float MeasureGlyph(const Text& text, size_t index) const {
+            char32_t code    = text[index];
+            float    kerning = 0 < index ? mFont->getKerning(text[index - 1], code, mFontSize) : 0.0f;
+
+            if (code == U'\t') {
+                return kerning + mFont->getGlyph(U' ', mFontSize, false).advance * 4.0f;
+            }
+
+            return kerning + mFont->getGlyph(code, mFontSize, false).advance;
+        }
+
+        void SumAdvances(size_t start) {
+            mCursorXs.resize(mAdvances.size() + 1);
+            mCursorXs[0] = 0.0f;
+
+            for (size_t i = start; i < mAdvances.size(); ++i) {
+                mCursorXs[i + 1] = mCursorXs[i] + mAdvances[i];
+            }
+        }
+
+    public:
+        GlyphRun() = default;
+
+        bool IsLaidOut(const std::shared_ptr<sf::Font>& font, size_t font_size) const {
+            return mFont != nullptr && mFont == font && mFontSize == font_size;
+        }
+
+        size_t GetSize() const {
+            return mAdvances.size();
+        }
+
+        float GetWidth() const {
+            return mCursorXs.empty() == true ? 0.0f : mCursorXs.back();
+        }
+
+        // x of the position before the character at index, clamped to the end of the run
+        float GetCursorX(size_t index) const {
+            return mCursorXs.empty() == true ? 0.0f : mCursorXs[std::min(index, mCursorXs.size() - 1)];
+        }
+
+        // Nearest position between characters, by binary search
+        size_t GetIndexAt(float x) const {
+            if (mCursorXs.empty() == true || x <= 0.0f) {
+                return 0;
+            }
+
+            auto iter = std::lower_bound(mCursorXs.begin(), mCursorXs.end(), x);
+
+            if (iter == mCursorXs.end()) {
+                return mCursorXs.size() - 1;
+            }
+
+            size_t index = static_cast<size_t>(iter - mCursorXs.begin());
+
+            if (0 < index && (x - mCursorXs[index - 1]) < (mCursorXs[index] - x)) {
+                return index - 1;
+            }
+
+            return index;
+        }
+
+        // Text is anything indexable by character, e.g. std::u32string, sf::String or GapBuffer
+        template <typename Text>
+        void Assign(const Text& text, size_t size, std::shared_ptr<sf::Font> font, size_t font_size) {
+            mFont     = std::move(font);
+            mFontSize = static_cast<unsigned int>(font_size);
+
+            mAdvances.resize(size);
+            mVertices.resize(size * VerticesPerGlyph);
+
+            for (size_t i = 0; i < size; ++i) {
+                mAdvances[i] = MeasureGlyph(text, i);
+            }
+
+            SumAdvances(0);
+
+            for (size_t i = 0; i < size; ++i) {
+                WriteQuad(i, text[i]);
+            }
+        }
+
+        // Call after the text lost `erased` characters at start and gained `inserted` there; size is the new length
+        template <typename Text>
+        void Splice(const Text& text, size_t size, size_t start, size_t erased, size_t inserted) {
+            if (mFont == nullptr || mAdvances.size() - erased + inserted != size) {
+                return;
+            }
+
+            // The new characters, and the one after them whose kerning pair changed
+            size_t measured = std::min(start + inserted + 1, size);
+            float  tail_x   = mCursorXs[measured - inserted + erased]; // where the first unchanged quad sits now
+
+            mAdvances.erase(mAdvances.begin() + start, mAdvances.begin() + start + erased);
+            mAdvances.insert(mAdvances.begin() + start, inserted, 0.0f);
+
+            mVertices.erase(mVertices.begin() + start * VerticesPerGlyph, mVertices.begin() + (start + erased) * VerticesPerGlyph);
+            mVertices.insert(mVertices.begin() + start * VerticesPerGlyph, inserted * VerticesPerGlyph, sf::Vertex());
+
+            for (size_t i = start; i < measured; ++i) {
+                mAdvances[i] = MeasureGlyph(text, i);
+            }
+
+            SumAdvances(start);
+
+            for (size_t i = start; i < measured; ++i) {
+                WriteQuad(i, text[i]);
+            }
+
+            // Everything after keeps its glyph and moves by the width the edit added or removed
+            float shift = measured < size ? mCursorXs[measured] - tail_x : 0.0f;
+
+            if (shift != 0.0f) {
+                for (size_t v = measured * VerticesPerGlyph; v < mVertices.size(); ++v) {
+                    mVertices[v].position.x += shift;
+                }
+            }
+        }
+
+        void SetColor(sf::Color color) {
+            if (color == mColor) {
+                return;
+            }
+
+            mColor = color;
+
+            for (sf::Vertex& vertex : mVertices) {
+                vertex.color = color;
+            }
+        }
+
+        // Draws the characters overlapping [clip_left, clip_right) in run space, with the run's origin at position
+        void Draw(sf::RenderTarget& target, sf::Vector2f position, float clip_left, float clip_right) const {
+            if (mFont == nullptr || mAdvances.empty() == true) {
+                return;
+            }
+
+            // Characters whose advance ends past the left edge, up to the first one starting at the right edge
+            size_t begin = static_cast<size_t>(std::upper_bound(mCursorXs.begin() + 1, mCursorXs.end(), clip_left) - (mCursorXs.begin() + 1));
+            size_t end   = static_cast<size_t>(std::lower_bound(mCursorXs.begin(), mCursorXs.end() - 1, clip_right) - mCursorXs.begin());
+
+            if (end <= begin) {
+                return;
+            }
+
+            sf::RenderStates states;
+
+            states.texture = &mFont->getTexture(mFontSize);
+            states.transform.translate(position);
+
+            target.draw(&mVertices[begin * VerticesPerGlyph], (end - begin) * VerticesPerGlyph, sf::PrimitiveType::Triangles, states);
+        }
+    };
+} // namespace Orbis
\ No newline at end of file
@@ -0,0 +1,271 @@
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+
+#include "Orbis/System/Controls.hpp"
+
+namespace Orbis {
+    // Binary layout, native endianness:
+    //   header  "ORBI" u32 version
+    //   frame   i64 time_ns, u8 flags, f32 mouse_x, f32 mouse_y, f32 wheel_delta, u16 event_count
+    //   event   u8 type, i64 time_ns, f32 x, f32 y, u8 button, i32 key, u32 unicode, f32 wheel_delta, u8 modifiers
+    // Times are nanoseconds since recording started; frame times come from the recorded context's clock.
+    namespace InputRecording {
+        inline constexpr std::array<char, 4> Magic   = {'O', 'R', 'B', 'I'};
+        inline constexpr uint32_t            Version = 1;
+
+        enum FrameFlag : uint8_t {
+            HasInput  = 1 << 0,
+            LPressed  = 1 << 1,
+            RPressed  = 1 << 2,
+            WPressed  = 1 << 3,
+            E1Pressed = 1 << 4,
+            E2Pressed = 1 << 5,
+            Scrolling = 1 << 6,
+        };
+
+        enum ModifierFlag : uint8_t {
+            Control = 1 << 0,
+            Shift   = 1 << 1,
+            Alt     = 1 << 2,
+        };
+
+        template <typename T>
+        void Write(std::ofstream& stream, T value) {
+            stream.write(reinterpret_cast<const char*>(&value), sizeof(T));
+        }
+
+        template <typename T>
+        bool Read(std::ifstream& stream, T& value) {
+            return static_cast<bool>(stream.read(reinterpret_cast<char*>(&value), sizeof(T)));
+        }
+
+        inline uint8_t GetModifiers(bool is_c_pressed, bool is_s_pressed, bool is_a_pressed) {
+            return (is_c_pressed ? Control : 0) | (is_s_pressed ? Shift : 0) | (is_a_pressed ? Alt : 0);
+        }
+
+        // Whether the raw fields name values of their enums, so a damaged file never becomes a made-up event
+        inline bool IsValidEvent(uint8_t type, uint8_t button, int32_t key) {
+            bool is_type_valid   = type <= static_cast<uint8_t>(InputType::TextEntered);
+            bool is_button_valid = static_cast<unsigned int>(button) < sf::Mouse::ButtonCount;
+            bool is_key_valid    = static_cast<int32_t>(sf::Keyboard::Key::Unknown) <= key && key < static_cast<int32_t>(sf::Keyboard::KeyCount);
+
+            return is_type_valid == true && is_button_valid == true && is_key_valid == true;
+        }
+    } // namespace InputRecording
+
+    // Appends every frame's Controls, exactly as handed to UIContext::Update(), to a file.
+    class InputRecorder {
+    private:
+        std::ofstream                         mStream;
+        std::chrono::steady_clock::time_point mStart;
+
+        int64_t GetOffset(std::chrono::steady_clock::time_point time) const {
+            return std::chrono::duration_cast<std::chrono::nanoseconds>(time - mStart).count();
+        }
+
+    public:
+        InputRecorder(const std::string& path, std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now()) : mStream(path, std::ios::binary | std::ios::trunc), mStart(start) {
+            if (mStream.is_open() == false) {
+                throw std::runtime_error("Failed to open input recording: " + path);
+            }
+
+            mStream.write(InputRecording::Magic.data(), InputRecording::Magic.size());
+            InputRecording::Write(mStream, InputRecording::Version);
+        }
+
+        void RecordFrame(const Controls& controls, bool has_input, std::chrono::steady_clock::time_point frame_time = std::chrono::steady_clock::now()) {
+            using namespace InputRecording;
+
+            const Mouse& mouse = controls.mMouse;
+            uint8_t      flags = 0;
+
+            flags |= has_input ? HasInput : 0;
+            flags |= mouse.mIsLPressed ? LPressed : 0;
+            flags |= mouse.mIsRPressed ? RPressed : 0;
+            flags |= mouse.mIsWPressed ? WPressed : 0;
+            flags |= mouse.mIsE1Pressed ? E1Pressed : 0;
+            flags |= mouse.mIsE2Pressed ? E2Pressed : 0;
+            flags |= mouse.mIsScrolling ? Scrolling : 0;
+
+            Write<int64_t>(mStream, GetOffset(frame_time));
+            Write<uint8_t>(mStream, flags);
+            Write<float>(mStream, mouse.mPosition.x);
+            Write<float>(mStream, mouse.mPosition.y);
+            Write<float>(mStream, mouse.mWheelDelta);
+            Write<uint16_t>(mStream, static_cast<uint16_t>(controls.mEvents.GetSize()));
+
+            for (const InputEvent& event : controls.mEvents) {
+                Write<uint8_t>(mStream, static_cast<uint8_t>(event.mType));
+                Write<int64_t>(mStream, GetOffset(event.mTime));
+                Write<float>(mStream, event.mPosition.x);
+                Write<float>(mStream, event.mPosition.y);
+                Write<uint8_t>(mStream, static_cast<uint8_t>(event.mButton));
+                Write<int32_t>(mStream, static_cast<int32_t>(event.mKey));
+                Write<uint32_t>(mStream, static_cast<uint32_t>(event.mUnicode));
+                Write<float>(mStream, event.mWheelDelta);
+                Write<uint8_t>(mStream, GetModifiers(event.mIsCPressed, event.mIsSPressed, event.mIsAPressed));
+            }
+        }
+
+        void Flush() {
+            mStream.flush();
+        }
+    };
+
+    // Reads a recording back one frame at a time, rebuilding the Controls a context would have seen.
+    // Timestamps are rebased onto a caller-chosen origin, so a replay never depends on the wall clock.
+    class InputPlayer {
+    private:
+        std::ifstream                         mStream;
+        std::chrono::steady_clock::time_point mOrigin;
+        std::chrono::steady_clock::time_point mFrameTime;
+        Controls                              mControls;
+        bool                                  mHasInput   = false;
+        bool                                  mIsCorrupt  = false;
+        size_t                                mFrameIndex = 0;
+
+        std::chrono::steady_clock::time_point GetTime(int64_t offset) const {
+            return mOrigin + std::chrono::duration_cast<std::chrono::steady_clock::duration>(std::chrono::nanoseconds(offset));
+        }
+
+    public:
+        InputPlayer(const std::string& path, std::chrono::steady_clock::time_point origin = {}) : mStream(path, std::ios::binary), mOrigin(origin), mFrameTime(origin) {
+            if (mStream.is_open() == false) {
+                throw std::runtime_error("Failed to open input recording: " + path);
+            }
+
+            std::array<char, 4> magic   = {};
+            uint32_t            version = 0;
+
+            mStream.read(magic.data(), magic.size());
+
+            if (!mStream || magic != InputRecording::Magic || InputRecording::Read(mStream, version) == false || version != InputRecording::Version) {
+                throw std::runtime_error("Not a supported input recording: " + path);
+            }
+        };
+
+        // Recorded time of the current frame, on the replay origin
+        std::chrono::steady_clock::time_point GetFrameTime() const {
+            return mFrameTime;
+        }
+
+        size_t GetFrameIndex() const {
+            return mFrameIndex;
+        }
+
+        const Controls& GetControls() const {
+            return mControls;
+        }
+
+        bool HasInput() const {
+            return mHasInput;
+        }
+
+        // Set when playback stopped at an event that doesn't decode to a valid one
+        bool IsCorrupt() const {
+            return mIsCorrupt;
+        }
+
+        // False once the recording is exhausted or found corrupt; a truncated trailing frame is dropped
+        bool NextFrame() {
+            using namespace InputRecording;
+
+            int64_t   frame_offset = 0;
+            uint8_t   flags        = 0;
+            uint16_t  event_count  = 0;
+            Mouse&    mouse        = mControls.mMouse;
+            Keyboard& keyboard     = mControls.mKeyboard;
+
+            mControls.ClearFrameEvents();
+
+            if (Read(mStream, frame_offset) == false || Read(mStream, flags) == false || Read(mStream, mouse.mPosition.x) == false || Read(mStream, mouse.mPosition.y) == false || Read(mStream, mouse.mWheelDelta) == false || Read(mStream, event_count) == false) {
+                return false;
+            }
+
+            mFrameTime         = GetTime(frame_offset);
+            mHasInput          = (flags & InputRecording::HasInput) != 0;
+            mouse.mIsLPressed  = (flags & LPressed) != 0;
+            mouse.mIsRPressed  = (flags & RPressed) != 0;
+            mouse.mIsWPressed  = (flags & WPressed) != 0;
+            mouse.mIsE1Pressed = (flags & E1Pressed) != 0;
+            mouse.mIsE2Pressed = (flags & E2Pressed) != 0;
+            mouse.mIsScrolling = (flags & Scrolling) != 0;
+
+            for (uint16_t i = 0; i < event_count; ++i) {
+                InputEvent event;
+                uint8_t    type      = 0;
+                int64_t    offset    = 0;
+                uint8_t    button    = 0;
+                int32_t    key       = 0;
+                uint32_t   unicode   = 0;
+                uint8_t    modifiers = 0;
+
+                if (Read(mStream, type) == false || Read(mStream, offset) == false || Read(mStream, event.mPosition.x) == false || Read(mStream, event.mPosition.y) == false || Read(mStream, button) == false || Read(mStream, key) == false || Read(mStream, unicode) == false || Read(mStream, event.mWheelDelta) == false || Read(mStream, modifiers) == false) {
+                    return false;
+                }
+
+                if (InputRecording::IsValidEvent(type, button, key) == false) {
+                    mIsCorrupt = true;
+
+                    mStream.setstate(std::ios::failbit);
+
+                    return false;
+                }
+
+                event.mType       = static_cast<InputType>(type);
+                event.mTime       = GetTime(offset);
+                event.mButton     = static_cast<sf::Mouse::Button>(button);
+                event.mKey        = static_cast<sf::Keyboard::Key>(key);
+                event.mUnicode    = static_cast<char32_t>(unicode);
+                event.mIsCPressed = (modifiers & Control) != 0;
+                event.mIsSPressed = (modifiers & Shift) != 0;
+                event.mIsAPressed = (modifiers & Alt) != 0;
+
+                // The per-frame aggregates are derived from the events, as ProcessEvent() would have filled them
+                switch (event.mType) {
+                    case InputType::MousePressed: {
+                        mouse.mButtonsPressed.push_back(event.mButton);
+                        break;
+                    }
+                    case InputType::MouseReleased: {
+                        mouse.mButtonsReleased.push_back(event.mButton);
+                        break;
+                    }
+                    case InputType::TextEntered: {
+                        keyboard.mTextEntered += event.mUnicode;
+                        break;
+                    }
+                    case InputType::KeyPressed: {
+                        keyboard.mKeysPressed.push_back(event.mKey);
+                        break;
+                    }
+                    case InputType::KeyReleased: {
+                        keyboard.mKeysReleased.push_back(event.mKey);
+                        break;
+                    }
+                    default: {
+                        break;
+                    }
+                }
+
+                if (event.mType == InputType::KeyPressed || event.mType == InputType::KeyReleased) {
+                    keyboard.mIsCPressed = event.mIsCPressed;
+                    keyboard.mIsSPressed = event.mIsSPressed;
+                    keyboard.mIsAPressed = event.mIsAPressed;
+                }
+
+                mControls.mEvents.Push(event);
+            }
+
+            mFrameIndex++;
+
+            return true;
+        }
+    };
+} // namespace Orbis
\ No newline at end of file
@@ -0,0 +1,174 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+#include <SFML/Graphics.hpp>
+
+namespace Orbis {
+    // Textured quads of a whole panel, grouped by texture within a zlevel so each texture costs one draw call.
+    // A quad joins the last group of its texture unless a later group overlaps it, so whatever was drawn over
+    // what still is. A null texture makes a plain colored quad. Groups keep their storage from frame to frame.
+    class QuadBatch {
+    private:
+        struct Group {
+            const sf::Texture*      mTexture = nullptr;
+            sf::FloatRect           mBounds;
+            std::vector<sf::Vertex> mVertices;
+        };
+
+        std::vector<Group> mGroups;
+        size_t             mGroupCount = 0; // groups in use, the rest are kept for their storage
+        size_t             mZLevel     = 0;
+
+        static QuadBatch*& GetCurrentSlot() {
+            thread_local QuadBatch* current = nullptr;
+
+            return current;
+        }
+
+        // Bounds with a positive size, whichever way a negative scale flipped the quad
+        static sf::FloatRect Normalize(sf::FloatRect rect) {
+            sf::Vector2f p0 = rect.position;
+            sf::Vector2f p1 = rect.position + rect.size;
+            sf::Vector2f lo = {std::min(p0.x, p1.x), std::min(p0.y, p1.y)};
+            sf::Vector2f hi = {std::max(p0.x, p1.x), std::max(p0.y, p1.y)};
+
+            return {lo, hi - lo};
+        }
+
+        static sf::FloatRect Merge(sf::FloatRect a, sf::FloatRect b) {
+            sf::Vector2f lo = {std::min(a.position.x, b.position.x), std::min(a.position.y, b.position.y)};
+            sf::Vector2f hi = {std::max(a.position.x + a.size.x, b.position.x + b.size.x), std::max(a.position.y + a.size.y, b.position.y + b.size.y)};
+
+            return {lo, hi - lo};
+        }
+
+        static void AppendQuad(sf::Vertex* vertices, sf::FloatRect quad, sf::FloatRect coords, sf::Color color) {
+            sf::Vector2f p0 = quad.position;
+            sf::Vector2f p1 = quad.position + quad.size;
+            sf::Vector2f t0 = coords.position;
+            sf::Vector2f t1 = coords.position + coords.size;
+
+            vertices[0] = {p0, color, t0};
+            vertices[1] = {{p1.x, p0.y}, color, {t1.x, t0.y}};
+            vertices[2] = {p1, color, t1};
+            vertices[3] = {p0, color, t0};
+            vertices[4] = {p1, color, t1};
+            vertices[5] = {{p0.x, p1.y}, color, {t0.x, t1.y}};
+        }
+
+        Group& GetGroupFor(const sf::Texture* texture, sf::FloatRect bounds) {
+            for (size_t i = mGroupCount; 0 < i; --i) {
+                Group& group = mGroups[i - 1];
+
+                if (group.mTexture == texture) {
+                    group.mBounds = Merge(group.mBounds, bounds);
+
+                    return group;
+                }
+
+                // Joining an earlier group would draw the quad under this one
+                if (group.mBounds.findIntersection(bounds).has_value() == true) {
+                    break;
+                }
+            }
+
+            if (mGroups.size() == mGroupCount) {
+                mGroups.emplace_back();
+            }
+
+            Group& group = mGroups[mGroupCount++];
+
+            group.mTexture = texture;
+            group.mBounds  = bounds;
+            group.mVertices.clear();
+
+            return group;
+        }
+
+    public:
+        QuadBatch() = default;
+
+        QuadBatch(const QuadBatch&)            = delete;
+        QuadBatch& operator=(const QuadBatch&) = delete;
+
+        // Batch bound to this thread by a QuadBatchScope, nullptr outside of one
+        static QuadBatch* GetCurrent() {
+            return GetCurrentSlot();
+        }
+
+        bool IsEmpty() const {
+            return mGroupCount == 0;
+        }
+
+        // Draw calls the next Flush() makes
+        size_t GetGroupCount() const {
+            return mGroupCount;
+        }
+
+        // Texture coordinates in pixels, as SFML expects them
+        void Add(const sf::Texture* texture, sf::FloatRect quad, sf::FloatRect coords, sf::Color color) {
+            Group& group = GetGroupFor(texture, Normalize(quad));
+            size_t size  = group.mVertices.size();
+
+            group.mVertices.resize(size + 6);
+
+            AppendQuad(group.mVertices.data() + size, quad, coords, color);
+        }
+
+        // Draws a single quad right away, for widgets rendered outside of any batch
+        static void Draw(sf::RenderTarget& target, const sf::Texture* texture, sf::FloatRect quad, sf::FloatRect coords, sf::Color color) {
+            sf::Vertex       vertices[6];
+            sf::RenderStates states;
+
+            AppendQuad(vertices, quad, coords, color);
+
+            states.texture = texture;
+
+            target.draw(vertices, 6, sf::PrimitiveType::Triangles, states);
+        }
+
+        // Widgets on different zlevels are only batched together up to the change
+        void SetZLevel(sf::RenderTarget& target, size_t zlevel) {
+            if (zlevel != mZLevel) {
+                Flush(target);
+
+                mZLevel = zlevel;
+            }
+        }
+
+        void Flush(sf::RenderTarget& target) {
+            for (size_t i = 0; i < mGroupCount; ++i) {
+                sf::RenderStates states;
+
+                states.texture = mGroups[i].mTexture;
+
+                target.draw(mGroups[i].mVertices.data(), mGroups[i].mVertices.size(), sf::PrimitiveType::Triangles, states);
+            }
+
+            mGroupCount = 0;
+        }
+
+        friend class QuadBatchScope;
+    };
+
+    // Binds a batch to the current thread for the lifetime of the scope, restoring the previous one afterwards
+    class QuadBatchScope {
+    private:
+        QuadBatch* mPrevious;
+
+    public:
+        QuadBatchScope(QuadBatch& batch) : mPrevious(QuadBatch::GetCurrentSlot()) {
+            QuadBatch::GetCurrentSlot() = &batch;
+        }
+
+        ~QuadBatchScope() {
+            QuadBatch::GetCurrentSlot() = mPrevious;
+        }
+
+        QuadBatchScope(const QuadBatchScope&)            = delete;
+        QuadBatchScope& operator=(const QuadBatchScope&) = delete;
+    };
+} // namespace Orbis
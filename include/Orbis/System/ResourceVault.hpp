@@ -1,22 +1,103 @@
 #pragma once
 
+#include <algorithm>
+#include <future>
 #include <memory>
+#include <mutex>
 #include <stdexcept>
 #include <string>
 #include <unordered_map>
+#include <vector>
 
 #include <SFML/Graphics.hpp>
 
 namespace Orbis {
+    // What a glyph warm-up left resident
+    struct GlyphPageStats {
+        size_t mGlyphCount = 0; // glyphs rasterized, characters the font lacks skipped
+        size_t mPageBytes  = 0; // texture memory of the warmed sizes' glyph pages, RGBA
+    };
+
+    // Loading and clearing are serialized, so one vault may be used from several window threads.
+    // sf::Font rasterizes glyphs lazily while drawing, so a font drawn from several threads at once should come from a per-context vault.
     class ResourceVault {
     private:
         std::unordered_map<std::string, std::shared_ptr<sf::Font>>    mFonts;
         std::unordered_map<std::string, std::shared_ptr<sf::Texture>> mTextures;
+        std::unordered_map<std::string, std::vector<unsigned int>>    mWarmedSizes; // per font path, for GetGlyphPageBytes()
+        std::mutex                                                    mMutex;
+
+        static size_t GetPageBytes(const sf::Font& font, unsigned int font_size) {
+            sf::Vector2u size = font.getTexture(font_size).getSize();
+
+            return static_cast<size_t>(size.x) * size.y * 4;
+        }
+
+        // The vault's font for the path, copied under the lock, or a fresh one if none was loaded yet
+        std::shared_ptr<sf::Font> CopyFont(const std::string& path) {
+            {
+                std::lock_guard<std::mutex> lock(mMutex);
+
+                auto iter = mFonts.find(path);
+
+                if (iter != mFonts.end()) {
+                    return std::make_shared<sf::Font>(*iter->second);
+                }
+            }
+
+            auto font = std::make_shared<sf::Font>();
+
+            if (font->openFromFile(path) == false) {
+                throw std::runtime_error("Failed to load font: " + path);
+            }
+
+            return font;
+        }
+
+        GlyphPageStats WarmFont(const std::string& path, std::shared_ptr<sf::Font> font, const sf::String& characters, const std::vector<unsigned int>& font_sizes, bool is_bold) {
+            std::vector<unsigned int> sizes = font_sizes;
+
+            std::sort(sizes.begin(), sizes.end());
+            sizes.erase(std::unique(sizes.begin(), sizes.end()), sizes.end());
+
+            GlyphPageStats stats;
+
+            for (unsigned int font_size : sizes) {
+                for (char32_t code : characters) {
+                    if (font->hasGlyph(code) == false) {
+                        continue;
+                    }
+
+                    font->getGlyph(code, font_size, is_bold);
+
+                    ++stats.mGlyphCount;
+                }
+
+                stats.mPageBytes += GetPageBytes(*font, font_size);
+            }
+
+            // Published whole, so GetGlyphPageBytes() only ever reads pages no one is filling.
+            // Warms of one path running at once each start from the same font, and the last to finish wins.
+            std::lock_guard<std::mutex> lock(mMutex);
+
+            std::vector<unsigned int>& warmed = mWarmedSizes[path];
+
+            warmed.insert(warmed.end(), sizes.begin(), sizes.end());
+
+            std::sort(warmed.begin(), warmed.end());
+            warmed.erase(std::unique(warmed.begin(), warmed.end()), warmed.end());
+
+            mFonts[path] = std::move(font);
+
+            return stats;
+        }
 
     public:
         ResourceVault() = default;
 
         std::shared_ptr<sf::Font> LoadFont(const std::string& path) {
+            std::lock_guard<std::mutex> lock(mMutex);
+
             std::string key  = path;
             auto        iter = mFonts.find(key);
 
@@ -36,6 +117,8 @@ namespace Orbis {
         }
 
         std::shared_ptr<sf::Texture> LoadTexture(const std::string& path, bool smoothing_enabled = false, bool srgb_enabled = false, const sf::IntRect& area = sf::IntRect()) {
+            std::lock_guard<std::mutex> lock(mMutex);
+
             std::string key = path;
 
             if (area != sf::IntRect()) {
@@ -69,11 +152,78 @@ namespace Orbis {
             return texture;
         }
 
+        // Every character from first to last inclusive, e.g. (U' ', U'~') for printable ASCII or (0x4E00, 0x9FFF) for CJK
+        static sf::String MakeCharacterRange(char32_t first, char32_t last) {
+            std::u32string characters;
+
+            if (last < first) {
+                return sf::String();
+            }
+
+            characters.reserve(static_cast<size_t>(last - first) + 1);
+
+            // Stops on last itself, so a range ending at the top of char32_t cannot wrap around
+            for (char32_t code = first;; ++code) {
+                characters.push_back(code);
+
+                if (code == last) {
+                    break;
+                }
+            }
+
+            return sf::String(characters);
+        }
+
+        // sf::Font rasterizes a glyph into its size's page texture the first time it is drawn, which stalls the frame
+        // that first shows a new character or size. This does it up front, e.g. behind a loading screen. The glyphs go
+        // into a copy of the vault's font, pages included, which then replaces it: earlier warms are kept, fonts handed
+        // out before are never written to, and LoadFont() returns the warmed one from then on. Drawings made with the
+        // font before the warm keep the cold one and rasterize as they go.
+        GlyphPageStats WarmGlyphs(const std::string& path, const sf::String& characters, const std::vector<unsigned int>& font_sizes, bool is_bold = false) {
+            return WarmFont(path, CopyFont(path), characters, font_sizes, is_bold);
+        }
+
+        // WarmGlyphs on a worker thread; SFML gives the thread its own GL context for the page uploads. The vault's font
+        // is copied here, on the calling thread, so drawing may go on meanwhile with it while nothing else touches the copy.
+        [[nodiscard]] std::future<GlyphPageStats> WarmGlyphsAsync(std::string path, sf::String characters, std::vector<unsigned int> font_sizes, bool is_bold = false) {
+            auto font = CopyFont(path);
+
+            return std::async(std::launch::async, [this, path = std::move(path), font = std::move(font), characters = std::move(characters), font_sizes = std::move(font_sizes), is_bold]() {
+                return WarmFont(path, font, characters, font_sizes, is_bold);
+            });
+        }
+
+        // Page memory of every size warmed so far, glyphs drawn since included
+        size_t GetGlyphPageBytes() {
+            std::lock_guard<std::mutex> lock(mMutex);
+
+            size_t bytes = 0;
+
+            for (const auto& [path, font_sizes] : mWarmedSizes) {
+                auto iter = mFonts.find(path);
+
+                if (iter == mFonts.end()) {
+                    continue;
+                }
+
+                for (unsigned int font_size : font_sizes) {
+                    bytes += GetPageBytes(*iter->second, font_size);
+                }
+            }
+
+            return bytes;
+        }
+
         void ClearFonts() {
+            std::lock_guard<std::mutex> lock(mMutex);
+
             mFonts.clear();
+            mWarmedSizes.clear();
         }
 
         void ClearTextures() {
+            std::lock_guard<std::mutex> lock(mMutex);
+
             mTextures.clear();
         }
 
@@ -0,0 +1,247 @@
+#pragma once
+
+#include <cstddef>
+
+// Lanes per batch, fixed once for the whole build through ORBIS_SIMD_WIDTH (the ORBIS_SIMD_WIDTH CMake option).
+// Every translation unit must see the same batch types, so the width never follows a TU's own target flags:
+// left unset, it's the instruction set the architecture always has, SSE2 on x86-64 and NEON on AArch64.
+//   8: AVX2, needs -mavx2 or /arch:AVX2 on every TU, which the CMake option adds
+//   4: SSE2 or NEON
+//   1: plain floats
+#ifndef ORBIS_SIMD_WIDTH
+#if defined(__x86_64__) || defined(_M_X64) || defined(__aarch64__) || defined(_M_ARM64)
+#define ORBIS_SIMD_WIDTH 4
+#else
+#define ORBIS_SIMD_WIDTH 1
+#endif
+#endif
+
+#if ORBIS_SIMD_WIDTH == 8
+#if !defined(__AVX2__)
+#error "ORBIS_SIMD_WIDTH 8 needs AVX2 enabled for every translation unit"
+#endif
+#define ORBIS_SIMD_AVX2
+#include <immintrin.h>
+#elif ORBIS_SIMD_WIDTH == 4
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define ORBIS_SIMD_SSE2
+#include <emmintrin.h>
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__) || defined(_M_ARM64)
+#define ORBIS_SIMD_NEON
+#include <arm_neon.h>
+#else
+#error "ORBIS_SIMD_WIDTH 4 needs SSE2 or NEON enabled for every translation unit"
+#endif
+#elif ORBIS_SIMD_WIDTH != 1
+#error "ORBIS_SIMD_WIDTH must be 8, 4 or 1"
+#endif
+
+namespace Orbis::Simd {
+    // A few lanes of floats with just the operations tween evaluation needs
+#if defined(ORBIS_SIMD_AVX2)
+    inline constexpr size_t Width = 8;
+
+    struct Batch {
+        __m256 mValue;
+    };
+
+    struct Mask {
+        __m256 mValue;
+    };
+
+    inline Batch Load(const float* ptr) {
+        return {_mm256_loadu_ps(ptr)};
+    }
+
+    inline void Store(float* ptr, Batch a) {
+        _mm256_storeu_ps(ptr, a.mValue);
+    }
+
+    inline Batch Set(float value) {
+        return {_mm256_set1_ps(value)};
+    }
+
+    inline Batch operator+(Batch a, Batch b) {
+        return {_mm256_add_ps(a.mValue, b.mValue)};
+    }
+
+    inline Batch operator-(Batch a, Batch b) {
+        return {_mm256_sub_ps(a.mValue, b.mValue)};
+    }
+
+    inline Batch operator*(Batch a, Batch b) {
+        return {_mm256_mul_ps(a.mValue, b.mValue)};
+    }
+
+    inline Batch Min(Batch a, Batch b) {
+        return {_mm256_min_ps(a.mValue, b.mValue)};
+    }
+
+    inline Batch Max(Batch a, Batch b) {
+        return {_mm256_max_ps(a.mValue, b.mValue)};
+    }
+
+    inline Mask operator<(Batch a, Batch b) {
+        return {_mm256_cmp_ps(a.mValue, b.mValue, _CMP_LT_OQ)};
+    }
+
+    inline Batch Select(Mask mask, Batch a, Batch b) {
+        return {_mm256_blendv_ps(b.mValue, a.mValue, mask.mValue)};
+    }
+#elif defined(ORBIS_SIMD_SSE2)
+    inline constexpr size_t Width = 4;
+
+    struct Batch {
+        __m128 mValue;
+    };
+
+    struct Mask {
+        __m128 mValue;
+    };
+
+    inline Batch Load(const float* ptr) {
+        return {_mm_loadu_ps(ptr)};
+    }
+
+    inline void Store(float* ptr, Batch a) {
+        _mm_storeu_ps(ptr, a.mValue);
+    }
+
+    inline Batch Set(float value) {
+        return {_mm_set1_ps(value)};
+    }
+
+    inline Batch operator+(Batch a, Batch b) {
+        return {_mm_add_ps(a.mValue, b.mValue)};
+    }
+
+    inline Batch operator-(Batch a, Batch b) {
+        return {_mm_sub_ps(a.mValue, b.mValue)};
+    }
+
+    inline Batch operator*(Batch a, Batch b) {
+        return {_mm_mul_ps(a.mValue, b.mValue)};
+    }
+
+    inline Batch Min(Batch a, Batch b) {
+        return {_mm_min_ps(a.mValue, b.mValue)};
+    }
+
+    inline Batch Max(Batch a, Batch b) {
+        return {_mm_max_ps(a.mValue, b.mValue)};
+    }
+
+    inline Mask operator<(Batch a, Batch b) {
+        return {_mm_cmplt_ps(a.mValue, b.mValue)};
+    }
+
+    // No blend before SSE4.1
+    inline Batch Select(Mask mask, Batch a, Batch b) {
+        return {_mm_or_ps(_mm_and_ps(mask.mValue, a.mValue), _mm_andnot_ps(mask.mValue, b.mValue))};
+    }
+#elif defined(ORBIS_SIMD_NEON)
+    inline constexpr size_t Width = 4;
+
+    struct Batch {
+        float32x4_t mValue;
+    };
+
+    struct Mask {
+        uint32x4_t mValue;
+    };
+
+    inline Batch Load(const float* ptr) {
+        return {vld1q_f32(ptr)};
+    }
+
+    inline void Store(float* ptr, Batch a) {
+        vst1q_f32(ptr, a.mValue);
+    }
+
+    inline Batch Set(float value) {
+        return {vdupq_n_f32(value)};
+    }
+
+    inline Batch operator+(Batch a, Batch b) {
+        return {vaddq_f32(a.mValue, b.mValue)};
+    }
+
+    inline Batch operator-(Batch a, Batch b) {
+        return {vsubq_f32(a.mValue, b.mValue)};
+    }
+
+    inline Batch operator*(Batch a, Batch b) {
+        return {vmulq_f32(a.mValue, b.mValue)};
+    }
+
+    inline Batch Min(Batch a, Batch b) {
+        return {vminq_f32(a.mValue, b.mValue)};
+    }
+
+    inline Batch Max(Batch a, Batch b) {
+        return {vmaxq_f32(a.mValue, b.mValue)};
+    }
+
+    inline Mask operator<(Batch a, Batch b) {
+        return {vcltq_f32(a.mValue, b.mValue)};
+    }
+
+    inline Batch Select(Mask mask, Batch a, Batch b) {
+        return {vbslq_f32(mask.mValue, a.mValue, b.mValue)};
+    }
+#else
+    inline constexpr size_t Width = 1;
+
+    struct Batch {
+        float mValue;
+    };
+
+    struct Mask {
+        bool mValue;
+    };
+
+    inline Batch Load(const float* ptr) {
+        return {*ptr};
+    }
+
+    inline void Store(float* ptr, Batch a) {
+        *ptr = a.mValue;
+    }
+
+    inline Batch Set(float value) {
+        return {value};
+    }
+
+    inline Batch operator+(Batch a, Batch b) {
+        return {a.mValue + b.mValue};
+    }
+
+    inline Batch operator-(Batch a, Batch b) {
+        return {a.mValue - b.mValue};
+    }
+
+    inline Batch operator*(Batch a, Batch b) {
+        return {a.mValue * b.mValue};
+    }
+
+    inline Batch Min(Batch a, Batch b) {
+        return {a.mValue < b.mValue ? a.mValue : b.mValue};
+    }
+
+    inline Batch Max(Batch a, Batch b) {
+        return {a.mValue < b.mValue ? b.mValue : a.mValue};
+    }
+
+    inline Mask operator<(Batch a, Batch b) {
+        return {a.mValue < b.mValue};
+    }
+
+    inline Batch Select(Mask mask, Batch a, Batch b) {
+        return {mask.mValue ? a.mValue : b.mValue};
+    }
+#endif
+
+    inline Batch Clamp(Batch a, float min, float max) {
+        return Min(Max(a, Set(min)), Set(max));
+    }
+} // namespace Orbis::Simd
\ No newline at end of file
@@ -0,0 +1,181 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+#include <SFML/Graphics.hpp>
+
+namespace Orbis {
+    // Uniform grid over axis-aligned bounds, keyed by caller-owned dense ids.
+    // Re-inserting an id whose bounds stay inside the same cells only rewrites the stored bounds.
+    // Cells cover a fixed area, anything outside of it lands in the nearest edge cell. They are laid out
+    // up front and never freed, so moving bounds around only allocates when a cell holds more ids than ever before.
+    class SpatialGrid {
+    private:
+        struct Entry {
+            sf::FloatRect mBounds;
+            sf::Vector2i  mCellMin    = {0, 0};
+            sf::Vector2i  mCellMax    = {0, 0};
+            bool          mIsInserted = false;
+        };
+
+        static constexpr size_t kCellReserve = 4;
+
+        float                              mCellSize = 128.0f;
+        sf::FloatRect                      mArea;
+        sf::Vector2i                       mCellCount = {1, 1};
+        std::vector<Entry>                 mEntries;
+        std::vector<std::vector<uint32_t>> mCells; // row-major
+
+        sf::Vector2i GetCell(sf::Vector2f point) const {
+            float x = std::floor((point.x - mArea.position.x) / mCellSize);
+            float y = std::floor((point.y - mArea.position.y) / mCellSize);
+
+            return {static_cast<int>(std::clamp(x, 0.0f, static_cast<float>(mCellCount.x - 1))), static_cast<int>(std::clamp(y, 0.0f, static_cast<float>(mCellCount.y - 1)))};
+        }
+
+        std::vector<uint32_t>& GetIds(int x, int y) {
+            return mCells[static_cast<size_t>(y) * static_cast<size_t>(mCellCount.x) + static_cast<size_t>(x)];
+        }
+
+        const std::vector<uint32_t>& GetIds(int x, int y) const {
+            return mCells[static_cast<size_t>(y) * static_cast<size_t>(mCellCount.x) + static_cast<size_t>(x)];
+        }
+
+        void LayOutCells() {
+            mCellCount = {std::max(static_cast<int>(std::ceil(mArea.size.x / mCellSize)), 1), std::max(static_cast<int>(std::ceil(mArea.size.y / mCellSize)), 1)};
+
+            mCells.assign(static_cast<size_t>(mCellCount.x) * static_cast<size_t>(mCellCount.y), {});
+
+            for (auto& ids : mCells) {
+                ids.reserve(kCellReserve);
+            }
+        }
+
+        void Unlink(uint32_t id) {
+            Entry& entry = mEntries[id];
+
+            for (int y = entry.mCellMin.y; y <= entry.mCellMax.y; ++y) {
+                for (int x = entry.mCellMin.x; x <= entry.mCellMax.x; ++x) {
+                    auto& ids     = GetIds(x, y);
+                    auto  iter_id = std::find(ids.begin(), ids.end(), id);
+
+                    if (iter_id != ids.end()) {
+                        *iter_id = ids.back();
+                        ids.pop_back();
+                    }
+                }
+            }
+
+            entry.mIsInserted = false;
+        }
+
+    public:
+        SpatialGrid() {
+            LayOutCells();
+        }
+
+        SpatialGrid(float cell_size) : mCellSize(cell_size) {
+            LayOutCells();
+        }
+
+        float GetCellSize() const {
+            return mCellSize;
+        }
+
+        sf::FloatRect GetArea() const {
+            return mArea;
+        }
+
+        // Both drop every id, to be inserted again
+        void SetCellSize(float cell_size) {
+            mCellSize = cell_size;
+
+            Clear();
+        }
+
+        void SetArea(sf::FloatRect area) {
+            mArea = area;
+
+            Clear();
+        }
+
+        void Update(uint32_t id, sf::FloatRect bounds) {
+            if (mEntries.size() <= id) {
+                mEntries.resize(id + 1);
+            }
+
+            sf::Vector2i cell_min = GetCell(bounds.position);
+            sf::Vector2i cell_max = GetCell(bounds.position + bounds.size);
+            Entry&       entry    = mEntries[id];
+
+            if (entry.mIsInserted == true && entry.mCellMin == cell_min && entry.mCellMax == cell_max) {
+                entry.mBounds = bounds;
+
+                return;
+            }
+
+            if (entry.mIsInserted == true) {
+                Unlink(id);
+            }
+
+            for (int y = cell_min.y; y <= cell_max.y; ++y) {
+                for (int x = cell_min.x; x <= cell_max.x; ++x) {
+                    GetIds(x, y).push_back(id);
+                }
+            }
+
+            entry.mBounds     = bounds;
+            entry.mCellMin    = cell_min;
+            entry.mCellMax    = cell_max;
+            entry.mIsInserted = true;
+        }
+
+        void Remove(uint32_t id) {
+            if (id < mEntries.size() && mEntries[id].mIsInserted == true) {
+                Unlink(id);
+            }
+        }
+
+        void Clear() {
+            mEntries.clear();
+
+            LayOutCells();
+        }
+
+        void Query(sf::Vector2f point, std::vector<uint32_t>& out) const {
+            sf::Vector2i cell = GetCell(point);
+
+            for (uint32_t id : GetIds(cell.x, cell.y)) {
+                if (mEntries[id].mBounds.contains(point) == true) {
+                    out.push_back(id);
+                }
+            }
+        }
+
+        // Every id whose bounds intersect the area, each reported once
+        void Query(sf::FloatRect area, std::vector<uint32_t>& out) const {
+            sf::Vector2i cell_min = GetCell(area.position);
+            sf::Vector2i cell_max = GetCell(area.position + area.size);
+
+            for (int y = cell_min.y; y <= cell_max.y; ++y) {
+                for (int x = cell_min.x; x <= cell_max.x; ++x) {
+                    for (uint32_t id : GetIds(x, y)) {
+                        const Entry& entry = mEntries[id];
+
+                        // An entry spanning several cells is only reported from the first one the area covers
+                        if (x != std::max(entry.mCellMin.x, cell_min.x) || y != std::max(entry.mCellMin.y, cell_min.y)) {
+                            continue;
+                        }
+
+                        if (entry.mBounds.findIntersection(area).has_value() == true) {
+                            out.push_back(id);
+                        }
+                    }
+                }
+            }
+        }
+    };
+} // namespace Orbis
\ No newline at end of file
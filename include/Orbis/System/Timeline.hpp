@@ -0,0 +1,472 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <vector>
+
+#include <SFML/Graphics.hpp>
+
+#include "Orbis/Anim.hpp"
+#include "Orbis/System/Animatable.hpp"
+#include "Orbis/System/Enums.hpp"
+
+namespace Orbis {
+    // CSS cubic-bezier(x1, y1, x2, y2). The curve is solved for y at evenly spaced x once, on construction,
+    // so evaluating it is a table lookup. Copies share the table; a default-constructed curve is linear.
+    class CubicBezier {
+    private:
+        static constexpr size_t Resolution = 128;
+
+        std::shared_ptr<const std::array<float, Resolution + 1>> mSamples;
+
+        static float Evaluate(float a, float b, float s) {
+            float r = 1.0f - s;
+
+            return 3.0f * r * r * s * a + 3.0f * r * s * s * b + s * s * s;
+        }
+
+        static float EvaluateSlope(float a, float b, float s) {
+            float r = 1.0f - s;
+
+            return 3.0f * r * r * a + 6.0f * r * s * (b - a) + 3.0f * s * s * (1.0f - b);
+        }
+
+        // Curve parameter at which x is reached: Newton's method, falling back to bisection on flat spots
+        static float SolveParameter(float x1, float x2, float x) {
+            float s = x;
+
+            for (int i = 0; i < 8; ++i) {
+                float error = Evaluate(x1, x2, s) - x;
+                float slope = EvaluateSlope(x1, x2, s);
+
+                if (std::abs(error) < 1e-6f) {
+                    return s;
+                }
+
+                if (std::abs(slope) < 1e-6f) {
+                    break;
+                }
+
+                s = std::clamp(s - error / slope, 0.0f, 1.0f);
+            }
+
+            float low  = 0.0f;
+            float high = 1.0f;
+
+            s = x;
+
+            for (int i = 0; i < 32; ++i) {
+                if (Evaluate(x1, x2, s) < x) {
+                    low = s;
+                }
+                else {
+                    high = s;
+                }
+
+                s = (low + high) * 0.5f;
+            }
+
+            return s;
+        }
+
+    public:
+        CubicBezier() = default;
+
+        // x1 and x2 are clamped to [0, 1] like in CSS, which keeps the curve a function of x
+        CubicBezier(float x1, float y1, float x2, float y2) {
+            x1 = std::clamp(x1, 0.0f, 1.0f);
+            x2 = std::clamp(x2, 0.0f, 1.0f);
+
+            auto samples = std::make_shared<std::array<float, Resolution + 1>>();
+
+            for (size_t i = 0; i <= Resolution; ++i) {
+                float x = static_cast<float>(i) / Resolution;
+
+                (*samples)[i] = Evaluate(y1, y2, SolveParameter(x1, x2, x));
+            }
+
+            mSamples = std::move(samples);
+        }
+
+        static const CubicBezier& Ease() {
+            static const CubicBezier curve(0.25f, 0.1f, 0.25f, 1.0f);
+
+            return curve;
+        }
+
+        static const CubicBezier& EaseIn() {
+            static const CubicBezier curve(0.42f, 0.0f, 1.0f, 1.0f);
+
+            return curve;
+        }
+
+        static const CubicBezier& EaseOut() {
+            static const CubicBezier curve(0.0f, 0.0f, 0.58f, 1.0f);
+
+            return curve;
+        }
+
+        static const CubicBezier& EaseInOut() {
+            static const CubicBezier curve(0.42f, 0.0f, 0.58f, 1.0f);
+
+            return curve;
+        }
+
+        bool IsLinear() const {
+            return mSamples == nullptr;
+        }
+
+        float operator()(float t) const {
+            if (mSamples == nullptr) {
+                return t;
+            }
+
+            float  x     = std::clamp(t, 0.0f, 1.0f) * Resolution;
+            size_t index = std::min(static_cast<size_t>(x), Resolution - 1);
+
+            return Anim::Lerp((*mSamples)[index], (*mSamples)[index + 1], x - static_cast<float>(index));
+        }
+    };
+
+    // Keyframes of one property of one target, sorted by time. Each keyframe's easing shapes the segment that
+    // follows it, as in CSS.
+    template <typename T>
+    class TimelineTrack {
+    private:
+        std::weak_ptr<Animatable> mOwner; // only checked for expiry, applied through mObject
+        Animatable*               mObject     = nullptr;
+        TweenProperty             mProperty   = TweenProperty::Position;
+        uint32_t                  mGeneration = 0;
+        bool                      mIsPlaying  = false;
+
+        std::vector<float>       mTimes;
+        std::vector<T>           mValues;
+        std::vector<CubicBezier> mEasings;
+
+        static sf::Vector2f Interpolate(sf::Vector2f from, sf::Vector2f to, float t) {
+            return Anim::LerpVector(from, to, t);
+        }
+
+        static sf::Color Interpolate(sf::Color from, sf::Color to, float t) {
+            return Anim::LerpColor(from, to, t);
+        }
+
+        static float Interpolate(float from, float to, float t) {
+            return Anim::Lerp(from, to, t);
+        }
+
+    public:
+        TimelineTrack(const std::shared_ptr<Animatable>& target, TweenProperty property) : mOwner(target), mObject(target.get()), mProperty(property) {};
+
+        bool IsFor(const Animatable* object, TweenProperty property) const {
+            return mObject == object && mProperty == property;
+        }
+
+        // Replaces a keyframe at the same time
+        void Key(float time, T value, CubicBezier easing) {
+            auto   iter  = std::lower_bound(mTimes.begin(), mTimes.end(), time);
+            size_t index = static_cast<size_t>(iter - mTimes.begin());
+
+            if (iter != mTimes.end() && *iter == time) {
+                mValues[index]  = value;
+                mEasings[index] = std::move(easing);
+
+                return;
+            }
+
+            mTimes.insert(iter, time);
+            mValues.insert(mValues.begin() + index, value);
+            mEasings.insert(mEasings.begin() + index, std::move(easing));
+        }
+
+        T Sample(float time) const {
+            if (time <= mTimes.front()) {
+                return mValues.front();
+            }
+
+            if (mTimes.back() <= time) {
+                return mValues.back();
+            }
+
+            size_t index = static_cast<size_t>(std::upper_bound(mTimes.begin(), mTimes.end(), time) - mTimes.begin()) - 1;
+            float  t     = (time - mTimes[index]) / (mTimes[index + 1] - mTimes[index]);
+
+            return Interpolate(mValues[index], mValues[index + 1], mEasings[index](t));
+        }
+
+        // Takes the property over from whatever tween is running on it
+        void Begin() {
+            std::shared_ptr<Animatable> owner = mOwner.lock();
+
+            if (mIsPlaying == true || owner == nullptr) {
+                return;
+            }
+
+            mGeneration = owner->BeginTween(mProperty);
+            mIsPlaying  = true;
+
+            owner->OnTweenStarted();
+        }
+
+        void End() {
+            if (mIsPlaying == false) {
+                return;
+            }
+
+            mIsPlaying = false;
+
+            if (mOwner.expired() == false) {
+                mObject->OnTweenEnded();
+            }
+        }
+
+        // A tween requested on the property since Begin() takes it back, and the track lets go until the next Begin()
+        void Apply(float time) {
+            if (mIsPlaying == false || mTimes.empty() == true || mOwner.expired() == true) {
+                return;
+            }
+
+            if (mObject->GetTweenGeneration(mProperty) != mGeneration) {
+                End();
+
+                return;
+            }
+
+            mObject->ApplyTween(mProperty, Sample(time));
+        }
+    };
+
+    // Keyframed animation over any number of targets and properties, played by an AnimationScheduler:
+    //
+    //     auto timeline = std::make_shared<Orbis::Timeline>();
+    //
+    //     timeline->Key(button.GetShared(), Orbis::TweenProperty::Position, 0.0f, sf::Vector2f(0, 0))
+    //         .Key(button.GetShared(), Orbis::TweenProperty::Position, 0.5f, sf::Vector2f(200, 0), Orbis::CubicBezier::EaseInOut())
+    //         .SetLoop(Orbis::TimelineLoop::PingPong);
+    //
+    //     context.GetAnimationScheduler().Play(timeline);
+    //
+    // Evaluating a track is a binary search for the segment plus a lookup in its easing table.
+    class Timeline {
+    private:
+        std::vector<TimelineTrack<sf::Vector2f>> mVectors;
+        std::vector<TimelineTrack<sf::Color>>    mColors;
+        std::vector<TimelineTrack<float>>        mFloats;
+
+        TimelineLoop          mLoop       = TimelineLoop::Once;
+        float                 mDuration   = 0.0f;
+        float                 mTime       = 0.0f; // playhead, unfolded by the loop mode when applied
+        float                 mSpeed      = 1.0f;
+        bool                  mIsPlaying  = false;
+        std::function<void()> mOnComplete = nullptr;
+
+        std::chrono::steady_clock::time_point mLastAdvance; // clock time the playhead was last moved to
+
+        template <typename T>
+        std::vector<TimelineTrack<T>>& GetTracks() {
+            if constexpr (std::is_same_v<T, sf::Vector2f>) {
+                return mVectors;
+            }
+            else if constexpr (std::is_same_v<T, sf::Color>) {
+                return mColors;
+            }
+            else {
+                return mFloats;
+            }
+        }
+
+        template <typename F>
+        void ForEachTrack(F&& func) {
+            for (auto& track : mVectors) {
+                func(track);
+            }
+
+            for (auto& track : mColors) {
+                func(track);
+            }
+
+            for (auto& track : mFloats) {
+                func(track);
+            }
+        }
+
+        // Playhead to time within the keyframes
+        float GetLocalTime() const {
+            if (mDuration <= 0.0f) {
+                return 0.0f;
+            }
+
+            switch (mLoop) {
+                case TimelineLoop::Loop: {
+                    float time = std::fmod(mTime, mDuration);
+
+                    return time < 0.0f ? time + mDuration : time;
+                }
+                case TimelineLoop::PingPong: {
+                    float time = std::fmod(mTime, 2.0f * mDuration);
+
+                    time = time < 0.0f ? time + 2.0f * mDuration : time;
+
+                    return time <= mDuration ? time : 2.0f * mDuration - time;
+                }
+                default: {
+                    return std::clamp(mTime, 0.0f, mDuration);
+                }
+            }
+        }
+
+        void Apply() {
+            float time = GetLocalTime();
+
+            ForEachTrack([time](auto& track) { track.Apply(time); });
+        }
+
+    public:
+        Timeline() = default;
+
+        Timeline(const Timeline&)            = delete;
+        Timeline& operator=(const Timeline&) = delete;
+
+        ~Timeline() {
+            ForEachTrack([](auto& track) { track.End(); });
+        }
+
+        // Adds a keyframe at the given time in seconds; the easing applies from this keyframe to the next
+        template <typename T>
+        Timeline& Key(const std::shared_ptr<Animatable>& target, TweenProperty property, float time, T value, CubicBezier easing = {}) {
+            auto& tracks = GetTracks<T>();
+            auto  iter   = std::find_if(tracks.begin(), tracks.end(), [&](const TimelineTrack<T>& track) { return track.IsFor(target.get(), property); });
+
+            if (iter == tracks.end()) {
+                tracks.emplace_back(target, property);
+                iter = tracks.end() - 1;
+
+                if (mIsPlaying == true) {
+                    iter->Begin();
+                }
+            }
+
+            iter->Key(time, value, std::move(easing));
+            mDuration = std::max(mDuration, time);
+
+            return *this;
+        }
+
+        Timeline& SetLoop(TimelineLoop loop) {
+            mLoop = loop;
+
+            return *this;
+        }
+
+        // Negative speeds play backward
+        Timeline& SetSpeed(float speed) {
+            mSpeed = speed;
+
+            return *this;
+        }
+
+        // Runs when a TimelineLoop::Once timeline reaches its end
+        Timeline& SetOnComplete(std::function<void()> on_complete) {
+            mOnComplete = std::move(on_complete);
+
+            return *this;
+        }
+
+        // Moves the playhead and writes the values there right away, so a paused timeline can be scrubbed
+        Timeline& Seek(float seconds) {
+            mTime = seconds;
+
+            if (mIsPlaying == false) {
+                ForEachTrack([](auto& track) { track.Begin(); });
+                Apply();
+                ForEachTrack([](auto& track) { track.End(); });
+            }
+
+            return *this;
+        }
+
+        TimelineLoop GetLoop() const {
+            return mLoop;
+        }
+
+        float GetSpeed() const {
+            return mSpeed;
+        }
+
+        float GetDuration() const {
+            return mDuration;
+        }
+
+        float GetTime() const {
+            return mTime;
+        }
+
+        bool IsPlaying() const {
+            return mIsPlaying;
+        }
+
+        // Called by the scheduler with the clock time playback starts at; a finished TimelineLoop::Once timeline
+        // restarts from the beginning
+        void Begin(std::chrono::steady_clock::time_point now) {
+            if (mLoop == TimelineLoop::Once && ((0.0f <= mSpeed && mDuration <= mTime) || (mSpeed < 0.0f && mTime <= 0.0f))) {
+                mTime = 0.0f < mSpeed ? 0.0f : mDuration;
+            }
+
+            mIsPlaying   = true;
+            mLastAdvance = now;
+
+            ForEachTrack([](auto& track) { track.Begin(); });
+        }
+
+        void Pause() {
+            mIsPlaying = false;
+
+            ForEachTrack([](auto& track) { track.End(); });
+        }
+
+        // Returns false once the timeline stops playing; the completion callback, if any, goes to completions
+        bool Advance(std::chrono::steady_clock::time_point now, std::vector<std::function<void()>>& completions) {
+            if (mIsPlaying == false) {
+                return false;
+            }
+
+            // Measured from this timeline's own last frame, so time the scheduler sat idle before Begin() doesn't count
+            float delta = 0.0f;
+
+            if (mLastAdvance < now) {
+                delta        = std::chrono::duration<float>(now - mLastAdvance).count();
+                mLastAdvance = now;
+            }
+
+            mTime += delta * mSpeed;
+
+            // Keep the playhead within one period so float precision doesn't run out on long loops
+            if (mLoop != TimelineLoop::Once && 0.0f < mDuration) {
+                float period = mLoop == TimelineLoop::PingPong ? 2.0f * mDuration : mDuration;
+
+                mTime = std::fmod(mTime, period);
+            }
+
+            Apply();
+
+            bool is_finished = mLoop == TimelineLoop::Once && (0.0f <= mSpeed ? mDuration <= mTime : mTime <= 0.0f);
+
+            if (is_finished == true) {
+                mTime = std::clamp(mTime, 0.0f, mDuration);
+
+                Pause();
+
+                if (mOnComplete) {
+                    completions.push_back(mOnComplete);
+                }
+            }
+
+            return mIsPlaying;
+        }
+    };
+} // namespace Orbis
\ No newline at end of file
@@ -0,0 +1,401 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <optional>
+#include <vector>
+
+#include "Orbis/System/Clock.hpp"
+
+namespace Orbis {
+    class TimerWheel;
+
+    // Refers to a scheduled timer; stays valid to hold after the timer fired or was cancelled.
+    // Must not outlive the wheel it came from.
+    class TimerHandle {
+    private:
+        TimerWheel* mWheel      = nullptr;
+        uint32_t    mIndex      = 0;
+        uint32_t    mGeneration = 0;
+
+    public:
+        TimerHandle() = default;
+
+        TimerHandle(TimerWheel* wheel, uint32_t index, uint32_t generation) : mWheel(wheel), mIndex(index), mGeneration(generation) {};
+
+        // False once a one-shot timer fired or any timer was cancelled
+        bool IsActive() const;
+
+        bool Cancel();
+
+        // Restarts the countdown of an active timer from now, e.g. to debounce; a timer that already fired must be scheduled again
+        bool Reschedule(float delay_seconds);
+    };
+
+    // Hierarchical timer wheel: five levels of 64 slots, each level's slot spanning a whole rotation of the level below.
+    // Scheduling and cancelling are O(1); Advance() only visits slots that hold timers, and a timer moves down a level
+    // at most once per level on its way to firing. At the default 1 ms resolution the levels reach about 12 days,
+    // beyond that timers wait in an overflow list.
+    class TimerWheel {
+    private:
+        static constexpr uint32_t SlotBits = 6;
+        static constexpr uint32_t Slots    = 1u << SlotBits;
+        static constexpr uint32_t Levels   = 5;
+        static constexpr uint32_t None     = std::numeric_limits<uint32_t>::max();
+        static constexpr uint32_t Overflow = Levels * Slots; // list index past the wheel slots
+
+        struct Timer {
+            std::function<void()> mCallback;
+            uint64_t              mExpiry     = 0; // in ticks
+            uint64_t              mPeriod     = 0; // in ticks, 0 for one-shot timers
+            uint32_t              mPrev       = None;
+            uint32_t              mNext       = None;
+            uint32_t              mList       = None; // slot holding the timer, None when free
+            uint32_t              mGeneration = 0;
+        };
+
+        std::vector<Timer>                       mTimers;
+        std::vector<uint32_t>                    mFree;
+        std::array<uint32_t, Levels * Slots + 1> mHeads;
+        std::array<uint64_t, Levels>             mOccupied = {}; // bit per non-empty slot
+
+        std::optional<std::chrono::steady_clock::time_point> mEpoch; // set by the first Advance() or schedule
+        const Clock*                                         mClock = nullptr;
+        float                                                mResolution;
+        uint64_t                                             mCurrent = 0; // last processed tick
+        size_t                                               mSize    = 0;
+
+        uint64_t ToTicks(float seconds) const {
+            return seconds <= 0.0f ? 0 : static_cast<uint64_t>(static_cast<double>(seconds) / mResolution + 0.5);
+        }
+
+        std::chrono::steady_clock::time_point GetNow() const {
+            return mClock != nullptr ? mClock->GetCurrentTime() : Clock::GetNow();
+        }
+
+        // Delays count from now rather than from the last Advance(), which may be long past when frames are skipped
+        uint64_t GetExpiry(float delay_seconds) {
+            auto now = GetNow();
+
+            if (mEpoch.has_value() == false) {
+                mEpoch = now;
+            }
+
+            double   elapsed = std::chrono::duration<double>(now - mEpoch.value()).count();
+            uint64_t tick    = elapsed <= 0.0 ? 0 : static_cast<uint64_t>(elapsed / mResolution);
+
+            return std::max(tick, mCurrent) + std::max<uint64_t>(ToTicks(delay_seconds), 1);
+        }
+
+        void Link(uint32_t index, uint32_t list) {
+            Timer& timer = mTimers[index];
+
+            timer.mList = list;
+            timer.mPrev = None;
+            timer.mNext = mHeads[list];
+
+            if (timer.mNext != None) {
+                mTimers[timer.mNext].mPrev = index;
+            }
+
+            mHeads[list] = index;
+
+            if (list != Overflow) {
+                mOccupied[list / Slots] |= uint64_t(1) << (list % Slots);
+            }
+        }
+
+        void Unlink(uint32_t index) {
+            Timer& timer = mTimers[index];
+
+            if (timer.mPrev != None) {
+                mTimers[timer.mPrev].mNext = timer.mNext;
+            }
+            else {
+                mHeads[timer.mList] = timer.mNext;
+            }
+
+            if (timer.mNext != None) {
+                mTimers[timer.mNext].mPrev = timer.mPrev;
+            }
+
+            if (timer.mList != Overflow && mHeads[timer.mList] == None) {
+                mOccupied[timer.mList / Slots] &= ~(uint64_t(1) << (timer.mList % Slots));
+            }
+
+            timer.mList = None;
+        }
+
+        // Lowest level whose rotation the expiry shares with the current tick
+        void Place(uint32_t index) {
+            uint64_t expiry = mTimers[index].mExpiry;
+
+            for (uint32_t level = 0; level < Levels; ++level) {
+                uint32_t shift = SlotBits * (level + 1);
+
+                if ((expiry >> shift) == (mCurrent >> shift)) {
+                    Link(index, level * Slots + static_cast<uint32_t>((expiry >> (SlotBits * level)) & (Slots - 1)));
+
+                    return;
+                }
+            }
+
+            Link(index, Overflow);
+        }
+
+        void Release(uint32_t index) {
+            Timer& timer = mTimers[index];
+
+            timer.mCallback = nullptr;
+            ++timer.mGeneration;
+
+            mFree.push_back(index);
+            --mSize;
+        }
+
+        bool IsValid(uint32_t index, uint32_t generation) const {
+            return index < mTimers.size() && mTimers[index].mGeneration == generation && mTimers[index].mList != None;
+        }
+
+        // Re-places every timer of a list, which lands them on lower levels
+        void Cascade(uint32_t list) {
+            uint32_t index = mHeads[list];
+
+            while (index != None) {
+                uint32_t next = mTimers[index].mNext;
+
+                Unlink(index);
+                Place(index);
+
+                index = next;
+            }
+        }
+
+        // Next tick at which some slot needs visiting, a lower bound for the next expiry
+        std::optional<uint64_t> GetNextEventTick() const {
+            std::optional<uint64_t> next;
+
+            for (uint32_t level = 0; level < Levels; ++level) {
+                uint32_t shift    = SlotBits * level;
+                uint32_t position = static_cast<uint32_t>((mCurrent >> shift) & (Slots - 1));
+                uint64_t ahead    = position + 1 < Slots ? mOccupied[level] & (~uint64_t(0) << (position + 1)) : 0;
+
+                if (ahead != 0) {
+                    uint64_t base = (mCurrent >> (shift + SlotBits)) << (shift + SlotBits);
+                    uint64_t tick = base | (uint64_t(std::countr_zero(ahead)) << shift);
+
+                    next = next.has_value() == true ? std::min(next.value(), tick) : tick;
+                }
+            }
+
+            if (mHeads[Overflow] != None) {
+                uint32_t shift = SlotBits * Levels;
+                uint64_t tick  = ((mCurrent >> shift) + 1) << shift;
+
+                next = next.has_value() == true ? std::min(next.value(), tick) : tick;
+            }
+
+            return next;
+        }
+
+        void Fire(uint32_t list) {
+            while (mHeads[list] != None) {
+                uint32_t index      = mHeads[list];
+                Timer&   timer      = mTimers[index];
+                uint32_t generation = timer.mGeneration;
+
+                Unlink(index);
+
+                // Moved out, since the callback may cancel or reschedule its own timer
+                std::function<void()> callback = std::move(timer.mCallback);
+
+                if (timer.mPeriod != 0) {
+                    timer.mExpiry = mCurrent + timer.mPeriod;
+
+                    Place(index);
+                }
+                else {
+                    Release(index);
+                }
+
+                if (callback) {
+                    callback();
+                }
+
+                if (IsValid(index, generation) == true && mTimers[index].mCallback == nullptr) {
+                    mTimers[index].mCallback = std::move(callback);
+                }
+            }
+        }
+
+    public:
+        // Resolution in seconds; timers fire on the first Advance() at or past their expiry, rounded to it
+        TimerWheel(float resolution = 0.001f) : mResolution(resolution) {
+            mHeads.fill(None);
+        }
+
+        TimerWheel(const TimerWheel&)            = delete;
+        TimerWheel& operator=(const TimerWheel&) = delete;
+
+        // Clock whose current time new delays count from; without one, the clock in scope through Clock::GetNow()
+        void SetClock(const Clock* clock) {
+            mClock = clock;
+        }
+
+        size_t GetSize() const {
+            return mSize;
+        }
+
+        bool IsEmpty() const {
+            return mSize == 0;
+        }
+
+        // Counts from the clock's current time; callbacks run from within Advance()
+        TimerHandle Schedule(float delay_seconds, std::function<void()> callback) {
+            return ScheduleRepeating(delay_seconds, 0.0f, std::move(callback));
+        }
+
+        // Fires after the delay, then every interval until cancelled, like auto-repeat on a held key
+        TimerHandle ScheduleRepeating(float delay_seconds, float interval_seconds, std::function<void()> callback) {
+            uint32_t index;
+
+            if (mFree.empty() == false) {
+                index = mFree.back();
+                mFree.pop_back();
+            }
+            else {
+                index = static_cast<uint32_t>(mTimers.size());
+                mTimers.emplace_back();
+            }
+
+            Timer& timer = mTimers[index];
+
+            timer.mCallback = std::move(callback);
+            timer.mExpiry   = GetExpiry(delay_seconds);
+            timer.mPeriod   = interval_seconds <= 0.0f ? 0 : std::max<uint64_t>(ToTicks(interval_seconds), 1);
+
+            Place(index);
+            ++mSize;
+
+            return TimerHandle(this, index, timer.mGeneration);
+        }
+
+        bool IsActive(uint32_t index, uint32_t generation) const {
+            return IsValid(index, generation);
+        }
+
+        bool Cancel(uint32_t index, uint32_t generation) {
+            if (IsValid(index, generation) == false) {
+                return false;
+            }
+
+            Unlink(index);
+            Release(index);
+
+            return true;
+        }
+
+        bool Reschedule(uint32_t index, uint32_t generation, float delay_seconds) {
+            if (IsValid(index, generation) == false) {
+                return false;
+            }
+
+            Unlink(index);
+
+            mTimers[index].mExpiry = GetExpiry(delay_seconds);
+
+            Place(index);
+
+            return true;
+        }
+
+        void Clear() {
+            for (uint32_t index = 0; index < mTimers.size(); ++index) {
+                if (mTimers[index].mList != None) {
+                    Unlink(index);
+                    Release(index);
+                }
+            }
+        }
+
+        // Runs every timer due by now, in expiry order across slots. A clock moving backward fires nothing.
+        void Advance(std::chrono::steady_clock::time_point now) {
+            if (mEpoch.has_value() == false) {
+                mEpoch = now;
+            }
+
+            double elapsed = std::chrono::duration<double>(now - mEpoch.value()).count();
+
+            if (elapsed <= 0.0) {
+                return;
+            }
+
+            uint64_t target = static_cast<uint64_t>(elapsed / mResolution);
+
+            // Jumps from one occupied slot to the next, so idle stretches cost nothing
+            while (true) {
+                std::optional<uint64_t> next = GetNextEventTick();
+
+                if (next.has_value() == false || target < next.value()) {
+                    break;
+                }
+
+                mCurrent = next.value();
+
+                // Higher levels first, their timers may land in a lower slot that is due right now
+                for (uint32_t level = Levels; 1 <= level; --level) {
+                    uint32_t shift = SlotBits * level;
+
+                    if ((mCurrent & ((uint64_t(1) << shift) - 1)) != 0) {
+                        continue;
+                    }
+
+                    if (level == Levels) {
+                        Cascade(Overflow);
+                    }
+                    else {
+                        Cascade(level * Slots + static_cast<uint32_t>((mCurrent >> shift) & (Slots - 1)));
+                    }
+                }
+
+                Fire(static_cast<uint32_t>(mCurrent & (Slots - 1)));
+            }
+
+            mCurrent = std::max(mCurrent, target);
+        }
+
+        // Earliest time a timer may fire, on the timeline of the clock that drives Advance()
+        std::optional<std::chrono::steady_clock::time_point> GetNextDeadline() const {
+            if (mSize == 0 || mEpoch.has_value() == false) {
+                return std::nullopt;
+            }
+
+            std::optional<uint64_t> next = GetNextEventTick();
+
+            if (next.has_value() == false) {
+                return std::nullopt;
+            }
+
+            auto offset = std::chrono::duration<double>(static_cast<double>(std::max(next.value(), mCurrent + 1)) * mResolution);
+
+            return mEpoch.value() + std::chrono::duration_cast<std::chrono::steady_clock::duration>(offset);
+        }
+    };
+
+    inline bool TimerHandle::IsActive() const {
+        return mWheel != nullptr && mWheel->IsActive(mIndex, mGeneration);
+    }
+
+    inline bool TimerHandle::Cancel() {
+        return mWheel != nullptr && mWheel->Cancel(mIndex, mGeneration);
+    }
+
+    inline bool TimerHandle::Reschedule(float delay_seconds) {
+        return mWheel != nullptr && mWheel->Reschedule(mIndex, mGeneration, delay_seconds);
+    }
+} // namespace Orbis
\ No newline at end of file
@@ -1,14 +1,30 @@
 #pragma once
 
+#include <atomic>
 #include <iostream>
+#include <mutex>
+#include <memory_resource>
+#include <numeric>
+#include <shared_mutex>
+#include <span>
 
 #include <SFML/Graphics.hpp>
 
 #include "Orbis/SFML/Shapes.hpp"
+#include "Orbis/System/AnimationScheduler.hpp"
+#include "Orbis/System/ChangeCounter.hpp"
+#include "Orbis/System/Clock.hpp"
 #include "Orbis/System/Controls.hpp"
+#include "Orbis/System/FocusManager.hpp"
+#include "Orbis/System/InputRecording.hpp"
+#include "Orbis/System/QuadBatch.hpp"
 #include "Orbis/System/ResourceVault.hpp"
+#include "Orbis/System/SpatialGrid.hpp"
+#include "Orbis/System/TimerWheel.hpp"
 #include "Orbis/Widgets/Button.hpp"
 #include "Orbis/Widgets/Canvas.hpp"
+#include "Orbis/Widgets/LogConsole.hpp"
+#include "Orbis/Widgets/ScrollView.hpp"
 #include "Orbis/Widgets/Slider.hpp"
 #include "Orbis/Widgets/Textbox.hpp"
 #include "Orbis/Widgets/Widget.hpp"
@@ -20,6 +36,8 @@ namespace Orbis {
 
     template <typename WT>
     class WidgetHandle;
+    template <typename WT>
+    class WidgetBatch;
     class PanelHandle;
     class SceneHandle;
     class UIContext;
@@ -27,7 +45,7 @@ namespace Orbis {
 } // namespace Orbis
 
 namespace Orbis {
-    class Panel : public std::enable_shared_from_this<Panel> {
+    class Panel : public std::enable_shared_from_this<Panel>, public Animatable {
     private:
         std::string  mName      = "Panel_Unnamed";
         sf::Vector2f mSize      = {0, 0};
@@ -36,23 +54,140 @@ namespace Orbis {
         bool         mIsVisible = true;
 
         std::vector<std::shared_ptr<Widget>> mWidgets;
-        std::optional<AnimationState>        mPosAnimation;
+        TweenQueue                           mTweens; // requested, handed to the scheduler on the next update
+
+        struct WidgetSlot {
+            uint32_t mRevision   = 0;
+            size_t   mZLevel     = 0;
+            size_t   mRank       = 0;
+            bool     mIsIndexed  = false;
+            bool     mHasSprites = false;
+        };
+
+        // Hit testing runs in panel-local space, so moving the panel never invalidates the grid.
+        SpatialGrid             mHitGrid;
+        std::vector<WidgetSlot> mWidgetSlots;
+        std::vector<uint32_t>   mWidgetOrder; // widget indices sorted by zlevel
+        std::vector<uint32_t>   mHovered;
+        std::vector<uint32_t>   mActive; // hovered or capturing after the last update
+        std::vector<uint32_t>   mDispatch;
+        std::vector<uint32_t>   mPressHits;
+        std::vector<uint32_t>   mSpriteWidgets; // sprites change frames whether or not the widget gets input
+        bool                    mIsOrderDirty      = true;
+        bool                    mIsGridDirty       = false; // a new area or cell size moves every widget to other cells
+        bool                    mIsSpriteListDirty = false;
+
+        // Quads of all the widgets, by texture within a zlevel, drawn together up to the next widget drawing on its own
+        QuadBatch mQuadBatch;
+
+        uint64_t mStructureRevision = 0; // bumped when widgets are added
+
+        bool                                                 mIsAnimating = false;
+        std::optional<std::chrono::steady_clock::time_point> mNextDeadline;
+
+        std::shared_ptr<AnimationGroup> mAnimationGroup = std::make_shared<AnimationGroup>(); // suspended while hidden
+
+        std::shared_ptr<ChangeCounter> mChanges = std::make_shared<ChangeCounter>(); // shared with the widgets
+        std::shared_ptr<SubmitList>    mSubmits = std::make_shared<SubmitList>();    // widgets with requested tweens
+        std::shared_ptr<DirtyList>     mDirty   = std::make_shared<DirtyList>();     // widgets changed since the last update
+
+        void RebuildWidgetOrder() {
+            mWidgetOrder.resize(mWidgets.size());
+            mWidgetSlots.resize(mWidgets.size());
+
+            std::iota(mWidgetOrder.begin(), mWidgetOrder.end(), 0);
+            std::stable_sort(mWidgetOrder.begin(), mWidgetOrder.end(), [this](uint32_t a, uint32_t b) {
+                return mWidgets[a]->GetZLevel() < mWidgets[b]->GetZLevel();
+            });
 
-        void UpdateAnimation() {
-            if (mPosAnimation.has_value() == true) {
-                if (mPosAnimation->IsComplete() == true) {
-                    mPosition = mPosAnimation->mTargetPos;
+            for (size_t rank = 0; rank < mWidgetOrder.size(); ++rank) {
+                mWidgetSlots[mWidgetOrder[rank]].mRank = rank;
+            }
 
-                    if (mPosAnimation->mOnComplete) {
-                        mPosAnimation->mOnComplete();
-                    }
+            mIsOrderDirty = false;
+        }
+
+        void RefreshWidget(uint32_t index) {
+            Widget&     widget = *mWidgets[index];
+            WidgetSlot& slot   = mWidgetSlots[index];
+
+            widget.ClearDirty();
+
+            if (slot.mHasSprites != widget.HasSprites()) {
+                slot.mHasSprites   = widget.HasSprites();
+                mIsSpriteListDirty = true;
+            }
+
+            if (slot.mIsIndexed == true && slot.mRevision == widget.GetRevision()) {
+                return;
+            }
+
+            mHitGrid.Update(index, widget.GetHitBounds());
+
+            if (slot.mIsIndexed == false || slot.mZLevel != widget.GetZLevel()) {
+                mIsOrderDirty = true;
+            }
+
+            slot.mRevision  = widget.GetRevision();
+            slot.mZLevel    = widget.GetZLevel();
+            slot.mIsIndexed = true;
+        }
+
+        // Only the widgets on the dirty list are looked at, unless the grid itself changed
+        void RefreshWidgets() {
+            mWidgetSlots.resize(mWidgets.size());
+
+            if (mIsGridDirty == true) {
+                for (uint32_t i = 0; i < mWidgets.size(); ++i) {
+                    mWidgetSlots[i].mIsIndexed = false;
+
+                    RefreshWidget(i);
+                }
+
+                mIsGridDirty = false;
+            }
+
+            for (uint32_t index : *mDirty) {
+                RefreshWidget(index);
+            }
+
+            mDirty->clear();
 
-                    mPosAnimation.reset();
+            if (mIsSpriteListDirty == true) {
+                mSpriteWidgets.clear();
+
+                for (uint32_t i = 0; i < mWidgetSlots.size(); ++i) {
+                    if (mWidgetSlots[i].mHasSprites == true) {
+                        mSpriteWidgets.push_back(i);
+                    }
                 }
-                else {
-                    mPosition = mPosAnimation->GetCurrentPosition();
+
+                mIsSpriteListDirty = false;
+            }
+
+            for (uint32_t index : mSpriteWidgets) {
+                mNextDeadline = Anim::GetEarlier(mNextDeadline, mWidgets[index]->GetNextDeadline());
+            }
+
+            if (mIsOrderDirty == true) {
+                RebuildWidgetOrder();
+            }
+        }
+
+        // Hands the panel's requested tweens and those of the widgets that queued themselves to the scheduler
+        void SubmitRequested(AnimationScheduler& scheduler) {
+            // A panel created outside a shared pointer has nothing to bind its tweens to, and they are dropped
+            if (mTweens.IsEmpty() == false) {
+                scheduler.Submit(mTweens, weak_from_this().lock());
+            }
+
+            for (const auto& queued : *mSubmits) {
+                if (auto widget = queued.lock(); widget != nullptr) {
+                    widget->SubmitAnimations(scheduler, widget);
                 }
             }
+
+            mSubmits->clear();
         }
 
     public:
@@ -78,6 +213,26 @@ namespace Orbis {
             return mIsVisible;
         }
 
+        const std::vector<std::shared_ptr<Widget>>& GetWidgets() const {
+            return mWidgets;
+        }
+
+        // Walks every widget, so it's only meant for when the Tab order is needed
+        uint64_t GetStructureRevision() const {
+            uint64_t revision = mStructureRevision;
+
+            for (const auto& widget : mWidgets) {
+                revision += widget->GetStructureRevision();
+            }
+
+            return revision;
+        }
+
+        // Mutations of the panel and its widgets so far
+        uint64_t GetChangeCount() const {
+            return mChanges->Get();
+        }
+
         Panel& SetName(const std::string& name) {
             mName = name;
 
@@ -87,63 +242,213 @@ namespace Orbis {
         Panel& SetSize(sf::Vector2f size) {
             mSize = size;
 
+            mHitGrid.SetArea({{0, 0}, size});
+
+            mIsGridDirty = true;
+
+            mChanges->Bump();
+
             return *this;
         }
 
         Panel& SetPosition(sf::Vector2f position) {
             mPosition = position;
 
+            mChanges->Bump();
+
             return *this;
         }
 
         Panel& SetZLevel(size_t zlevel) {
             mZLevel = zlevel;
 
+            mChanges->Bump();
+
             return *this;
         }
 
         Panel& SetVisibility(bool visible) {
-            mIsVisible = visible;
+            mIsVisible                    = visible;
+            mAnimationGroup->mIsSuspended = visible == false;
+
+            mChanges->Bump();
+
+            return *this;
+        }
+
+        SuspendPolicy GetSuspendPolicy() const {
+            return mAnimationGroup->mPolicy;
+        }
+
+        // What the tweens of the panel and its widgets do while it's hidden
+        Panel& SetSuspendPolicy(SuspendPolicy policy) {
+            mAnimationGroup->mPolicy = policy;
+
+            return *this;
+        }
+
+        Panel& SetHitCellSize(float cell_size) {
+            mHitGrid.SetCellSize(cell_size);
+
+            mIsGridDirty = true;
 
             return *this;
         }
 
+        // Widgets may come with tweens requested before they joined, so they go on the submit list right away
         Panel& AddWidget(std::shared_ptr<Widget> widget) {
+            widget->BindChanges(mChanges, mSubmits);
+            widget->BindDirty(mDirty, static_cast<uint32_t>(mWidgets.size()));
+
             mWidgets.push_back(widget);
+            mSubmits->push_back(widget);
+
+            mIsOrderDirty = true;
+            ++mStructureRevision;
+
+            mChanges->Bump();
 
             return *this;
         }
 
-        Panel& PositionAnimation(sf::Vector2f target, float duration, std::function<void()> on_complete = nullptr, std::function<float(float)> easing = Anim::EaseOutQuad) {
-            if (mPosAnimation.has_value() == false) {
-                mPosAnimation = AnimationState();
+        Panel& AddWidgets(std::span<const std::shared_ptr<Widget>> widgets) {
+            for (size_t i = 0; i < widgets.size(); ++i) {
+                widgets[i]->BindChanges(mChanges, mSubmits);
+                widgets[i]->BindDirty(mDirty, static_cast<uint32_t>(mWidgets.size() + i));
             }
 
-            mPosAnimation->Start(mPosition, target, duration, std::move(on_complete));
-            mPosAnimation->SetEasing(easing);
+            mWidgets.insert(mWidgets.end(), widgets.begin(), widgets.end());
+            mSubmits->insert(mSubmits->end(), widgets.begin(), widgets.end());
+
+            mIsOrderDirty = true;
+            ++mStructureRevision;
+
+            mChanges->Bump();
+
+            return *this;
+        }
+
+        // Starts on the next update of the context the panel belongs to
+        Panel& PositionAnimation(sf::Vector2f target, float duration, std::function<void()> on_complete = nullptr, EasingCurve easing = Easing::OutQuad) {
+            mTweens.Push<sf::Vector2f>(*this, {}, TweenProperty::Position, mPosition, target, duration, std::move(on_complete), std::move(easing));
+
+            mChanges->Bump();
+
+            return *this;
+        }
+
+        Panel& PositionSpring(sf::Vector2f target, SpringParams params = {}, std::function<void()> on_complete = nullptr) {
+            mTweens.PushSpring(*this, {}, TweenProperty::Position, mPosition, target, params, std::move(on_complete));
+
+            mChanges->Bump();
 
             return *this;
         }
 
-        void Update(const Controls& controls) {
-            UpdateAnimation();
+        using Animatable::ApplyTween;
+
+        bool ApplyTween(TweenProperty property, sf::Vector2f value) override {
+            if (property != TweenProperty::Position) {
+                return false;
+            }
+
+            mPosition = value;
+
+            mChanges->Bump();
+
+            return true;
+        }
+
+        // Both reflect the last Update(), and let an idle context know whether it may skip the next frame
+        bool IsAnimating() const {
+            return mIsAnimating;
+        }
+
+        std::optional<std::chrono::steady_clock::time_point> GetNextDeadline() const {
+            return mNextDeadline;
+        }
+
+        // Topmost focus target at the window position as of the last update, looking into containers
+        std::shared_ptr<Widget> FindFocusAt(sf::Vector2f position) {
+            if (mIsVisible == false) {
+                return nullptr;
+            }
+
+            mPressHits.clear();
+            mHitGrid.Query(position - mPosition, mPressHits);
+
+            std::sort(mPressHits.begin(), mPressHits.end(), [this](uint32_t a, uint32_t b) {
+                return mWidgetSlots[a].mRank > mWidgetSlots[b].mRank;
+            });
+
+            for (uint32_t index : mPressHits) {
+                if (mWidgets[index]->GetVisibility() == false) {
+                    continue;
+                }
+
+                if (auto hit = mWidgets[index]->FindFocusAt(position - mPosition); hit != nullptr) {
+                    return hit;
+                }
+            }
+
+            return nullptr;
+        }
+
+        // Only hands requested tweens to the scheduler, so they start on time while the panel is hidden
+        void SubmitSuspended(AnimationScheduler& scheduler) {
+            AnimationGroupScope group_scope(scheduler, mAnimationGroup);
+
+            SubmitRequested(scheduler);
+        }
+
+        void Update(const Controls& controls, AnimationScheduler& scheduler) {
+            mIsAnimating = false;
+            mNextDeadline.reset();
 
             if (mIsVisible == false) {
+                SubmitSuspended(scheduler);
+
                 return;
             }
 
-            std::vector<std::pair<size_t, std::shared_ptr<Widget>>> sorted_widgets;
+            AnimationGroupScope group_scope(scheduler, mAnimationGroup);
+
+            SubmitRequested(scheduler);
+
+            // The group counts the running tweens of the panel and of all its widgets and drawings
+            mIsAnimating = 0 < mAnimationGroup->mActiveTweens;
+
+            RefreshWidgets();
+
+            // Only widgets under the pointer, plus last frame's hovered/capturing ones so they can react to leaving, get input
+            mHovered.clear();
+            mHitGrid.Query(controls.mMouse.mPosition - mPosition, mHovered);
 
-            for (auto& widget : mWidgets) {
-                sorted_widgets.push_back({widget->GetZLevel(), widget});
+            mDispatch.assign(mHovered.begin(), mHovered.end());
+            mDispatch.insert(mDispatch.end(), mActive.begin(), mActive.end());
+
+            // A click that started and ended away from where the pointer rests now must still reach its widget
+            for (const InputEvent& event : controls.mEvents) {
+                if (event.mType == InputType::MousePressed || event.mType == InputType::MouseReleased) {
+                    mHitGrid.Query(event.mPosition - mPosition, mDispatch);
+                }
             }
 
-            std::sort(sorted_widgets.begin(), sorted_widgets.end(), [](const auto& a, const auto& b) {
-                return a.first < b.first;
+            std::sort(mDispatch.begin(), mDispatch.end(), [this](uint32_t a, uint32_t b) {
+                return mWidgetSlots[a].mRank < mWidgetSlots[b].mRank;
             });
 
-            for (const auto& [zlevel, widget] : sorted_widgets) {
-                widget->UpdateImpl(controls, mPosition);
+            mDispatch.erase(std::unique(mDispatch.begin(), mDispatch.end()), mDispatch.end());
+            mActive.assign(mHovered.begin(), mHovered.end());
+
+            for (uint32_t index : mDispatch) {
+                mWidgets[index]->UpdateImpl(controls, mPosition);
+
+                if (mWidgets[index]->HasCapture() == true) {
+                    mActive.push_back(index);
+                }
+
+                mNextDeadline = Anim::GetEarlier(mNextDeadline, mWidgets[index]->GetNextDeadline());
             }
         }
 
@@ -152,19 +457,23 @@ namespace Orbis {
                 return;
             }
 
-            std::vector<std::pair<size_t, std::shared_ptr<Widget>>> sorted_widgets;
-
-            for (auto& widget : mWidgets) {
-                sorted_widgets.push_back({widget->GetZLevel(), widget});
+            if (mIsOrderDirty == true || mWidgetOrder.size() != mWidgets.size()) {
+                RebuildWidgetOrder();
             }
 
-            std::sort(sorted_widgets.begin(), sorted_widgets.end(), [](const auto& a, const auto& b) {
-                return a.first < b.first;
-            });
+            QuadBatchScope scope(mQuadBatch);
 
-            for (const auto& [zlevel, widget] : sorted_widgets) {
-                widget->RenderImpl(window, mPosition);
+            for (uint32_t index : mWidgetOrder) {
+                mQuadBatch.SetZLevel(window, mWidgets[index]->GetZLevel());
+
+                if (mWidgets[index]->IsQuadBatchable() == false) {
+                    mQuadBatch.Flush(window);
+                }
+
+                mWidgets[index]->RenderImpl(window, mPosition);
             }
+
+            mQuadBatch.Flush(window);
         }
     };
 
@@ -173,7 +482,29 @@ namespace Orbis {
         std::string                         mName     = "Scene_Unnamed";
         bool                                mIsActive = false;
         std::vector<std::shared_ptr<Panel>> mPanels;
-        bool                                mIsRegistered = false;
+        bool                                mIsRegistered      = false;
+        uint64_t                            mStructureRevision = 0;
+
+        bool                                                 mIsAnimating = false;
+        std::optional<std::chrono::steady_clock::time_point> mNextDeadline;
+
+        std::vector<uint32_t> mPanelOrder; // reused every frame, panels may change zlevel at any time
+
+        ChangeCounter mChanges; // activation and added panels; the panels count their own
+
+        std::optional<SuspendPolicy> mSuspendPolicy; // left to each panel until set
+
+        void SortPanels() {
+            mPanelOrder.resize(mPanels.size());
+
+            std::iota(mPanelOrder.begin(), mPanelOrder.end(), 0);
+            std::sort(mPanelOrder.begin(), mPanelOrder.end(), [this](uint32_t a, uint32_t b) {
+                size_t zlevel_a = mPanels[a]->GetZLevel();
+                size_t zlevel_b = mPanels[b]->GetZLevel();
+
+                return zlevel_a != zlevel_b ? zlevel_a < zlevel_b : a < b;
+            });
+        }
 
     public:
         Scene() = default;
@@ -186,6 +517,10 @@ namespace Orbis {
             return mIsActive;
         }
 
+        const std::vector<std::shared_ptr<Panel>>& GetPanels() const {
+            return mPanels;
+        }
+
         Scene& SetName(const std::string& name) {
             mName = name;
             return *this;
@@ -198,52 +533,121 @@ namespace Orbis {
                 panel->SetVisibility(is_active);
             }
 
+            mChanges.Bump();
+
+            return *this;
+        }
+
+        std::optional<SuspendPolicy> GetSuspendPolicy() const {
+            return mSuspendPolicy;
+        }
+
+        // Applies to every panel of the scene, including those added later
+        Scene& SetSuspendPolicy(SuspendPolicy policy) {
+            mSuspendPolicy = policy;
+
+            for (auto& panel : mPanels) {
+                panel->SetSuspendPolicy(policy);
+            }
+
             return *this;
         }
 
         Scene& AddPanel(std::shared_ptr<Panel> panel) {
+            if (mSuspendPolicy.has_value() == true) {
+                panel->SetSuspendPolicy(mSuspendPolicy.value());
+            }
+
             mPanels.push_back(panel);
 
+            ++mStructureRevision;
+
+            mChanges.Bump();
+
             return *this;
         }
 
-        void Update(const Controls& controls) {
+        bool IsAnimating() const {
+            return mIsAnimating;
+        }
+
+        std::optional<std::chrono::steady_clock::time_point> GetNextDeadline() const {
+            return mNextDeadline;
+        }
+
+        // Panels run bottom to top in the order of the last update, so the last hit is the one drawn on top
+        std::shared_ptr<Widget> FindFocusAt(sf::Vector2f position) {
+            std::shared_ptr<Widget> hit;
+
             if (mIsActive == false) {
-                return;
+                return hit;
+            }
+
+            for (uint32_t index : mPanelOrder) {
+                if (auto panel_hit = mPanels[index]->FindFocusAt(position); panel_hit != nullptr) {
+                    hit = panel_hit;
+                }
             }
 
-            std::vector<std::pair<size_t, std::shared_ptr<Panel>>> sorted_panels;
+            return hit;
+        }
 
-            for (auto& panel : mPanels) {
-                sorted_panels.push_back({panel->GetZLevel(), panel});
+        uint64_t GetStructureRevision() const {
+            uint64_t revision = mStructureRevision;
+
+            for (const auto& panel : mPanels) {
+                revision += panel->GetStructureRevision();
             }
 
-            std::sort(sorted_panels.begin(), sorted_panels.end(), [](const auto& a, const auto& b) {
-                return a.first < b.first;
-            });
+            return revision;
+        }
 
-            for (const auto& [zlevel, panel] : sorted_panels) {
-                panel->Update(controls);
+        uint64_t GetChangeCount() const {
+            uint64_t changes = mChanges.Get();
+
+            for (const auto& panel : mPanels) {
+                changes += panel->GetChangeCount();
             }
+
+            return changes;
         }
 
-        void Render(sf::RenderWindow& window) {
+        void Update(const Controls& controls, AnimationScheduler& scheduler) {
+            mIsAnimating = false;
+            mNextDeadline.reset();
+
             if (mIsActive == false) {
+                for (auto& panel : mPanels) {
+                    panel->SubmitSuspended(scheduler);
+                }
+
                 return;
             }
 
-            std::vector<std::pair<size_t, std::shared_ptr<Panel>>> sorted_panels;
+            SortPanels();
 
-            for (auto& panel : mPanels) {
-                sorted_panels.push_back({panel->GetZLevel(), panel});
+            for (uint32_t index : mPanelOrder) {
+                Panel& panel = *mPanels[index];
+
+                panel.Update(controls, scheduler);
+
+                if (panel.IsAnimating() == true) {
+                    mIsAnimating = true;
+                }
+
+                mNextDeadline = Anim::GetEarlier(mNextDeadline, panel.GetNextDeadline());
             }
+        }
 
-            std::sort(sorted_panels.begin(), sorted_panels.end(), [](const auto& a, const auto& b) {
-                return a.first < b.first;
-            });
+        void Render(sf::RenderWindow& window) {
+            if (mIsActive == false) {
+                return;
+            }
 
-            for (const auto& [zlevel, panel] : sorted_panels) {
-                panel->Render(window);
+            SortPanels();
+
+            for (uint32_t index : mPanelOrder) {
+                mPanels[index]->Render(window);
             }
         }
 
@@ -265,6 +669,54 @@ namespace Orbis {
     template <typename T>
     concept IsTextboxSingle = std::is_same_v<T, TextboxSingle>;
 
+    template <typename T>
+    concept IsTextboxMulti = std::is_same_v<T, TextboxMulti>;
+
+    template <typename T>
+    concept IsScrollView = std::is_same_v<T, ScrollView>;
+
+    template <typename T>
+    concept IsLogConsole = std::is_same_v<T, LogConsole>;
+
+    // Widget class behind each WidgetType
+    template <WidgetType Type>
+    struct WidgetClass;
+
+    template <>
+    struct WidgetClass<WidgetType::Canvas> {
+        using Class = Canvas;
+    };
+
+    template <>
+    struct WidgetClass<WidgetType::Button> {
+        using Class = Button;
+    };
+
+    template <>
+    struct WidgetClass<WidgetType::Slider> {
+        using Class = Slider;
+    };
+
+    template <>
+    struct WidgetClass<WidgetType::TextboxSingle> {
+        using Class = TextboxSingle;
+    };
+
+    template <>
+    struct WidgetClass<WidgetType::TextboxMulti> {
+        using Class = TextboxMulti;
+    };
+
+    template <>
+    struct WidgetClass<WidgetType::ScrollView> {
+        using Class = ScrollView;
+    };
+
+    template <>
+    struct WidgetClass<WidgetType::LogConsole> {
+        using Class = LogConsole;
+    };
+
     template <typename WT>
     class WidgetHandle {
     private:
@@ -293,6 +745,10 @@ namespace Orbis {
             return mWidget->GetTexture(id);
         }
 
+        DrawingsSprite& GetSprite(const std::string& id) {
+            return mWidget->GetSprite(id);
+        }
+
         WidgetHandle& SetSize(sf::Vector2f size) {
             mWidget->SetSize(size);
 
@@ -317,24 +773,60 @@ namespace Orbis {
             return *this;
         }
 
-        WidgetHandle& PositionAnimation(sf::Vector2f target, float duration, std::function<void()> on_complete = nullptr, std::function<float(float)> easing = Anim::EaseOutQuad) {
+        WidgetHandle& PositionAnimation(sf::Vector2f target, float duration, std::function<void()> on_complete = nullptr, EasingCurve easing = Easing::OutQuad) {
             mWidget->PositionAnimation(target, duration, on_complete, easing);
 
             return *this;
         }
 
-        WidgetHandle& ScaleAnimation(sf::Vector2f target_scale, float duration, std::function<void()> on_complete = nullptr, std::function<float(float)> easing = Anim::EaseOutQuad) {
+        WidgetHandle& ScaleAnimation(sf::Vector2f target_scale, float duration, std::function<void()> on_complete = nullptr, EasingCurve easing = Easing::OutQuad) {
             mWidget->ScaleAnimation(target_scale, duration, on_complete, easing);
 
             return *this;
         }
 
+        WidgetHandle& PositionSpring(sf::Vector2f target, SpringParams params = {}, std::function<void()> on_complete = nullptr) {
+            mWidget->PositionSpring(target, params, std::move(on_complete));
+
+            return *this;
+        }
+
+        WidgetHandle& ScaleSpring(sf::Vector2f target_scale, SpringParams params = {}, std::function<void()> on_complete = nullptr) {
+            mWidget->ScaleSpring(target_scale, params, std::move(on_complete));
+
+            return *this;
+        }
+
         WidgetHandle& CancelAnimation() {
             mWidget->CancelAnimation();
 
             return *this;
         }
 
+        WidgetHandle& SizeAnimation(DrawingType type, const std::string& id, sf::Vector2f target, float duration, std::function<void()> on_complete = nullptr, EasingCurve easing = Easing::OutQuad) {
+            mWidget->SizeAnimation(type, id, target, duration, std::move(on_complete), std::move(easing));
+
+            return *this;
+        }
+
+        WidgetHandle& ColorAnimation(DrawingType type, const std::string& id, sf::Color target, float duration, std::function<void()> on_complete = nullptr, EasingCurve easing = Easing::OutQuad) {
+            mWidget->ColorAnimation(type, id, target, duration, std::move(on_complete), std::move(easing));
+
+            return *this;
+        }
+
+        WidgetHandle& OutlineColorAnimation(const std::string& id, sf::Color target, float duration, std::function<void()> on_complete = nullptr, EasingCurve easing = Easing::OutQuad) {
+            mWidget->OutlineColorAnimation(id, target, duration, std::move(on_complete), std::move(easing));
+
+            return *this;
+        }
+
+        WidgetHandle& AlphaAnimation(DrawingType type, const std::string& id, float target, float duration, std::function<void()> on_complete = nullptr, EasingCurve easing = Easing::OutQuad) {
+            mWidget->AlphaAnimation(type, id, target, duration, std::move(on_complete), std::move(easing));
+
+            return *this;
+        }
+
         // Button
         WidgetHandle& SetOnButtonPressed(std::function<void()> callback) requires IsButton<WT> {
             static_cast<Button*>(mWidget.get())->SetOnButtonPressed(callback);
@@ -365,6 +857,12 @@ namespace Orbis {
             return *this;
         }
 
+        WidgetHandle& ValueAnimation(float target, float duration, std::function<void()> on_complete = nullptr, EasingCurve easing = Easing::OutQuad) requires IsSlider<WT> {
+            static_cast<Slider*>(mWidget.get())->ValueAnimation(target, duration, std::move(on_complete), std::move(easing));
+
+            return *this;
+        }
+
         WidgetHandle& SetStepSize(float step) requires IsSlider<WT> {
             static_cast<Slider*>(mWidget.get())->SetStepSize(step);
 
@@ -488,33 +986,216 @@ namespace Orbis {
             return *this;
         }
 
-        // Drawings
-        WidgetHandle& DrawLine(const std::string& id, const std::vector<sf::Vector2f>& points, size_t zlevel, sf::Color color, float thickness) {
-            mWidget->DrawLine(id, points, zlevel, color, thickness);
+        // TextboxMulti
+        bool IsContentEmpty() const requires IsTextboxMulti<WT> {
+            return static_cast<const TextboxMulti*>(mWidget.get())->IsContentEmpty();
+        }
 
-            return *this;
+        const sf::String& GetTextContent() const requires IsTextboxMulti<WT> {
+            return static_cast<const TextboxMulti*>(mWidget.get())->GetTextContent();
         }
 
-        WidgetHandle& DrawRect(const std::string& id, sf::Vector2f size, sf::Vector2f position, size_t zlevel, sf::Color fill_color, bool is_outlined = false, float outline_thickness = 0.0f, sf::Color outline_color = sf::Color::Black, bool is_rounded = false, float rounding_radius = 0.0f) {
-            mWidget->DrawRect(id, size, position, zlevel, fill_color, is_outlined, outline_thickness, outline_color, is_rounded, rounding_radius);
+        size_t GetLineCount() const requires IsTextboxMulti<WT> {
+            return static_cast<const TextboxMulti*>(mWidget.get())->GetLineCount();
+        }
+
+        sf::String GetLine(size_t line) const requires IsTextboxMulti<WT> {
+            return static_cast<const TextboxMulti*>(mWidget.get())->GetLine(line);
+        }
+
+        size_t GetCursorLine() const requires IsTextboxMulti<WT> {
+            return static_cast<const TextboxMulti*>(mWidget.get())->GetCursorLine();
+        }
+
+        size_t GetCursorColumn() const requires IsTextboxMulti<WT> {
+            return static_cast<const TextboxMulti*>(mWidget.get())->GetCursorColumn();
+        }
+
+        WidgetHandle& SetEditableText(const std::string& text_id) requires IsTextboxMulti<WT> {
+            static_cast<TextboxMulti*>(mWidget.get())->SetEditableText(text_id);
 
             return *this;
         }
 
-        WidgetHandle& DrawText(const std::string& id, size_t font_size, sf::Vector2f position, size_t zlevel, sf::Color fill_color, std::shared_ptr<sf::Font> font, TextAlign align = TextAlign::LeftTop, const std::string& text = "") {
-            mWidget->DrawText(id, font_size, position, zlevel, fill_color, font, align, text);
+        WidgetHandle& SetEditableWText(const std::string& wtext_id) requires IsTextboxMulti<WT> {
+            static_cast<TextboxMulti*>(mWidget.get())->SetEditableWText(wtext_id);
 
             return *this;
         }
 
-        WidgetHandle& DrawWText(const std::string& id, size_t font_size, sf::Vector2f position, size_t zlevel, sf::Color fill_color, std::shared_ptr<sf::Font> font, TextAlign align = TextAlign::LeftTop, const std::wstring& wtext = L"") {
-            mWidget->DrawWText(id, font_size, position, zlevel, fill_color, font, align, wtext);
+        WidgetHandle& SetPadding(float padding) requires IsTextboxMulti<WT> {
+            static_cast<TextboxMulti*>(mWidget.get())->SetPadding(padding);
 
             return *this;
         }
 
-        WidgetHandle& DrawTexture(const std::string& id, sf::Vector2f size, sf::Vector2f position, size_t zlevel, sf::Color fill_color, std::shared_ptr<sf::Texture> texture, sf::Vector2f scale = {1.0f, 1.0f}) {
-            mWidget->DrawTexture(id, size, position, zlevel, fill_color, texture, scale);
+        WidgetHandle& SetScrollStep(size_t lines) requires IsTextboxMulti<WT> {
+            static_cast<TextboxMulti*>(mWidget.get())->SetScrollStep(lines);
+
+            return *this;
+        }
+
+        WidgetHandle& SetText(const sf::String& text) requires IsTextboxMulti<WT> {
+            static_cast<TextboxMulti*>(mWidget.get())->SetText(text);
+
+            return *this;
+        }
+
+        WidgetHandle& ClearText() requires IsTextboxMulti<WT> {
+            static_cast<TextboxMulti*>(mWidget.get())->ClearText();
+
+            return *this;
+        }
+
+        WidgetHandle& SetOnTextChanged(std::function<void()> callback) requires IsTextboxMulti<WT> {
+            static_cast<TextboxMulti*>(mWidget.get())->SetOnTextChanged(callback);
+
+            return *this;
+        }
+
+        // ScrollView
+        sf::Vector2f GetScrollOffset() const requires IsScrollView<WT> {
+            return static_cast<const ScrollView*>(mWidget.get())->GetScrollOffset();
+        }
+
+        template <typename CT>
+        WidgetHandle& AddChild(const WidgetHandle<CT>& child_handle) requires IsScrollView<WT> {
+            static_cast<ScrollView*>(mWidget.get())->AddChild(child_handle.GetShared());
+
+            return *this;
+        }
+
+        template <typename CT>
+        WidgetHandle& AddChildren(const WidgetBatch<CT>& child_batch) requires IsScrollView<WT> {
+            static_cast<ScrollView*>(mWidget.get())->AddChildren(child_batch.GetShared());
+
+            return *this;
+        }
+
+        WidgetHandle& SetScrollOffset(sf::Vector2f offset) requires IsScrollView<WT> {
+            static_cast<ScrollView*>(mWidget.get())->SetScrollOffset(offset);
+
+            return *this;
+        }
+
+        WidgetHandle& ScrollBy(sf::Vector2f delta) requires IsScrollView<WT> {
+            static_cast<ScrollView*>(mWidget.get())->ScrollBy(delta);
+
+            return *this;
+        }
+
+        WidgetHandle& ScrollAnimation(sf::Vector2f offset, float duration, std::function<void()> on_complete = nullptr, EasingCurve easing = Easing::OutQuad) requires IsScrollView<WT> {
+            static_cast<ScrollView*>(mWidget.get())->ScrollAnimation(offset, duration, std::move(on_complete), std::move(easing));
+
+            return *this;
+        }
+
+        WidgetHandle& ScrollSpring(sf::Vector2f offset, SpringParams params = {}, std::function<void()> on_complete = nullptr) requires IsScrollView<WT> {
+            static_cast<ScrollView*>(mWidget.get())->ScrollSpring(offset, params, std::move(on_complete));
+
+            return *this;
+        }
+
+        WidgetHandle& SetScrollStep(float step) requires IsScrollView<WT> {
+            static_cast<ScrollView*>(mWidget.get())->SetScrollStep(step);
+
+            return *this;
+        }
+
+        // LogConsole
+        size_t GetLineCount() const requires IsLogConsole<WT> {
+            return static_cast<const LogConsole*>(mWidget.get())->GetLineCount();
+        }
+
+        size_t GetShownLineCount() const requires IsLogConsole<WT> {
+            return static_cast<const LogConsole*>(mWidget.get())->GetShownLineCount();
+        }
+
+        bool IsStuckToBottom() const requires IsLogConsole<WT> {
+            return static_cast<const LogConsole*>(mWidget.get())->IsStuckToBottom();
+        }
+
+        WidgetHandle& Append(const sf::String& text, std::optional<sf::Color> color = std::nullopt) requires IsLogConsole<WT> {
+            static_cast<LogConsole*>(mWidget.get())->Append(text, color);
+
+            return *this;
+        }
+
+        WidgetHandle& Clear() requires IsLogConsole<WT> {
+            static_cast<LogConsole*>(mWidget.get())->Clear();
+
+            return *this;
+        }
+
+        WidgetHandle& SetCapacity(size_t lines) requires IsLogConsole<WT> {
+            static_cast<LogConsole*>(mWidget.get())->SetCapacity(lines);
+
+            return *this;
+        }
+
+        WidgetHandle& SetFilter(const sf::String& needle) requires IsLogConsole<WT> {
+            static_cast<LogConsole*>(mWidget.get())->SetFilter(needle);
+
+            return *this;
+        }
+
+        WidgetHandle& SetLineStyle(const std::string& text_id) requires IsLogConsole<WT> {
+            static_cast<LogConsole*>(mWidget.get())->SetLineStyle(text_id);
+
+            return *this;
+        }
+
+        WidgetHandle& SetPadding(float padding) requires IsLogConsole<WT> {
+            static_cast<LogConsole*>(mWidget.get())->SetPadding(padding);
+
+            return *this;
+        }
+
+        WidgetHandle& SetScrollStep(size_t lines) requires IsLogConsole<WT> {
+            static_cast<LogConsole*>(mWidget.get())->SetScrollStep(lines);
+
+            return *this;
+        }
+
+        WidgetHandle& ScrollToBottom() requires IsLogConsole<WT> {
+            static_cast<LogConsole*>(mWidget.get())->ScrollToBottom();
+
+            return *this;
+        }
+
+        // Drawings
+        WidgetHandle& DrawLine(const std::string& id, const std::vector<sf::Vector2f>& points, size_t zlevel, sf::Color color, float thickness) {
+            mWidget->DrawLine(id, points, zlevel, color, thickness);
+
+            return *this;
+        }
+
+        WidgetHandle& DrawRect(const std::string& id, sf::Vector2f size, sf::Vector2f position, size_t zlevel, sf::Color fill_color, bool is_outlined = false, float outline_thickness = 0.0f, sf::Color outline_color = sf::Color::Black, bool is_rounded = false, float rounding_radius = 0.0f) {
+            mWidget->DrawRect(id, size, position, zlevel, fill_color, is_outlined, outline_thickness, outline_color, is_rounded, rounding_radius);
+
+            return *this;
+        }
+
+        WidgetHandle& DrawText(const std::string& id, size_t font_size, sf::Vector2f position, size_t zlevel, sf::Color fill_color, std::shared_ptr<sf::Font> font, TextAlign align = TextAlign::LeftTop, const std::string& text = "") {
+            mWidget->DrawText(id, font_size, position, zlevel, fill_color, font, align, text);
+
+            return *this;
+        }
+
+        WidgetHandle& DrawWText(const std::string& id, size_t font_size, sf::Vector2f position, size_t zlevel, sf::Color fill_color, std::shared_ptr<sf::Font> font, TextAlign align = TextAlign::LeftTop, const std::wstring& wtext = L"") {
+            mWidget->DrawWText(id, font_size, position, zlevel, fill_color, font, align, wtext);
+
+            return *this;
+        }
+
+        WidgetHandle& DrawTexture(const std::string& id, sf::Vector2f size, sf::Vector2f position, size_t zlevel, sf::Color fill_color, std::shared_ptr<sf::Texture> texture, sf::Vector2f scale = {1.0f, 1.0f}) {
+            mWidget->DrawTexture(id, size, position, zlevel, fill_color, texture, scale);
+
+            return *this;
+        }
+
+        WidgetHandle& DrawSprite(const std::string& id, sf::Vector2f size, sf::Vector2f position, size_t zlevel, sf::Color fill_color, std::shared_ptr<sf::Texture> texture, sf::IntRect atlas, sf::Vector2i frame_size, size_t frame_count, float frames_per_second, bool is_looping = true) {
+            mWidget->DrawSprite(id, size, position, zlevel, fill_color, texture, atlas, frame_size, frame_count, frames_per_second, is_looping);
 
             return *this;
         }
@@ -527,6 +1208,130 @@ namespace Orbis {
         }
     };
 
+    // Widgets of a single type, constructed in one contiguous block.
+    // Each widget gets an owner of its own that keeps the block alive, so shared_from_this() works on it and the
+    // storage lives as long as any of them does. The owners' control blocks come from one arena, so a batch costs a
+    // handful of allocations whatever its size, instead of one per widget.
+    template <typename WT>
+    class WidgetBatch {
+    private:
+        // A control block goes back only after its deleter dropped the storage, so the arena can't live in the
+        // storage: it counts the blocks still out, plus one while the batch is being built, and frees itself with the last
+        class ControlArena {
+        private:
+            std::pmr::monotonic_buffer_resource mResource;
+            std::atomic<size_t>                 mHolds = 1;
+
+        public:
+            ControlArena(size_t bytes) : mResource(bytes) {};
+
+            void* Allocate(size_t bytes, size_t alignment) {
+                void* ptr = mResource.allocate(bytes, alignment);
+
+                mHolds.fetch_add(1, std::memory_order_relaxed);
+
+                return ptr;
+            }
+
+            // Monotonic, so only the count goes down until the whole arena does
+            void Release() {
+                if (mHolds.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+                    delete this;
+                }
+            }
+        };
+
+        template <typename T>
+        class ControlAllocator {
+        public:
+            using value_type = T;
+
+            ControlArena* mArena;
+
+            ControlAllocator(ControlArena* arena) : mArena(arena) {};
+
+            template <typename U>
+            ControlAllocator(const ControlAllocator<U>& other) : mArena(other.mArena) {}
+
+            T* allocate(size_t count) {
+                return static_cast<T*>(mArena->Allocate(count * sizeof(T), alignof(T)));
+            }
+
+            void deallocate(T* ptr, size_t count) {
+                (void)ptr;
+                (void)count;
+
+                mArena->Release();
+            }
+
+            template <typename U>
+            bool operator==(const ControlAllocator<U>& other) const {
+                return mArena == other.mArena;
+            }
+        };
+
+        // Roughly a control block with a deleter and an allocator, the arena grows past it if needed
+        static constexpr size_t ControlBlockBytes = 64;
+
+        std::shared_ptr<std::vector<WT>>     mStorage;
+        std::vector<std::shared_ptr<Widget>> mShared;
+
+    public:
+        WidgetBatch(size_t count) : mStorage(std::make_shared<std::vector<WT>>(count)) {
+            mShared.reserve(count);
+
+            // The hold taken at construction is dropped on leaving, thrown out of or not
+            struct ArenaHold {
+                ControlArena* mArena;
+
+                ~ArenaHold() {
+                    mArena->Release();
+                }
+            };
+
+            ArenaHold hold = {new ControlArena(std::max(count, size_t(1)) * ControlBlockBytes)};
+
+            for (auto& widget : *mStorage) {
+                // Let go of the block once the widget's last owner is gone; the deleter itself outlives that while
+                // the widget's own weak pointer does
+                auto deleter = [storage = mStorage](WT*) mutable {
+                    storage.reset();
+                };
+
+                mShared.push_back(std::shared_ptr<WT>(&widget, std::move(deleter), ControlAllocator<WT>(hold.mArena)));
+            }
+        }
+
+        size_t GetCount() const {
+            return mStorage->size();
+        }
+
+        std::span<WT> GetWidgets() {
+            return std::span<WT>(*mStorage);
+        }
+
+        std::span<const std::shared_ptr<Widget>> GetShared() const {
+            return std::span<const std::shared_ptr<Widget>>(mShared);
+        }
+
+        WidgetHandle<WT> GetHandle(size_t index) const {
+            if (mStorage->size() <= index) {
+                throw std::out_of_range("WidgetBatch index out of range");
+            }
+
+            return WidgetHandle<WT>(std::static_pointer_cast<WT>(mShared[index]));
+        }
+
+        template <typename Func>
+        WidgetBatch& ForEach(Func&& func) {
+            for (size_t i = 0; i < mStorage->size(); ++i) {
+                func((*mStorage)[i], i);
+            }
+
+            return *this;
+        }
+    };
+
     class PanelHandle {
     private:
         std::shared_ptr<Panel> mPanel;
@@ -568,6 +1373,18 @@ namespace Orbis {
             return *this;
         }
 
+        PanelHandle& SetSuspendPolicy(SuspendPolicy policy) {
+            mPanel->SetSuspendPolicy(policy);
+
+            return *this;
+        }
+
+        PanelHandle& SetHitCellSize(float cell_size) {
+            mPanel->SetHitCellSize(cell_size);
+
+            return *this;
+        }
+
         template <typename WT>
         PanelHandle& AddWidget(const WidgetHandle<WT>& widget_handle) {
             mPanel->AddWidget(widget_handle.GetShared());
@@ -575,11 +1392,24 @@ namespace Orbis {
             return *this;
         }
 
-        PanelHandle& PositionAnimation(sf::Vector2f target, float duration, std::function<void()> on_complete = nullptr, std::function<float(float)> easing = Anim::EaseOutQuad) {
+        template <typename WT>
+        PanelHandle& AddWidgets(const WidgetBatch<WT>& widget_batch) {
+            mPanel->AddWidgets(widget_batch.GetShared());
+
+            return *this;
+        }
+
+        PanelHandle& PositionAnimation(sf::Vector2f target, float duration, std::function<void()> on_complete = nullptr, EasingCurve easing = Easing::OutQuad) {
             mPanel->PositionAnimation(target, duration, std::move(on_complete), easing);
 
             return *this;
         }
+
+        PanelHandle& PositionSpring(sf::Vector2f target, SpringParams params = {}, std::function<void()> on_complete = nullptr) {
+            mPanel->PositionSpring(target, params, std::move(on_complete));
+
+            return *this;
+        }
     };
 
     class SceneHandle {
@@ -605,6 +1435,12 @@ namespace Orbis {
             return *this;
         }
 
+        SceneHandle& SetSuspendPolicy(SuspendPolicy policy) {
+            mScene->SetSuspendPolicy(policy);
+
+            return *this;
+        }
+
         SceneHandle& AddPanel(const PanelHandle& panel_handle) {
             mScene->AddPanel(panel_handle.GetShared());
 
@@ -614,15 +1450,182 @@ namespace Orbis {
         SceneHandle& Register(UIContext& context);
     };
 
+    struct FrameStatus {
+        bool mIsSkipped   = false; // nothing could change, so no panel or widget was touched
+        bool mNeedsRedraw = true;  // the previous frame's output is stale
+
+        // Earliest wall time the UI changes on its own, now() while animating, empty if only input can wake it
+        std::optional<std::chrono::steady_clock::time_point> mNextDeadline;
+    };
+
     class UIContext {
     private:
-        Controls mControls;
-
         std::vector<std::shared_ptr<Panel>> mPanels; // Standalone panels?
         std::vector<std::shared_ptr<Scene>> mScenes;
+        uint64_t                            mStructureRevision = 0;
+
+        ResourceVault      mResourceVault; // for resources that must not be shared with other window threads
+        FocusManager       mFocus;
+        AnimationScheduler mScheduler;     // every tween of this context's panels and widgets
+        TimerWheel         mTimers;        // tooltips, toasts, debounces, auto-repeat; driven by the context clock
+        Clock              mClock;         // ticked once per Update(), bound to the thread while updating and rendering
+
+        bool                                                 mIsEventDriven = false;
+        std::atomic<bool>                                    mIsInvalidated = true;
+        bool                                                 mIsAnimating   = false;
+        uint64_t                                             mChangesSeen   = 0;
+        std::optional<std::chrono::steady_clock::time_point> mNextDeadline; // on the context clock
+
+        // Timers may have been scheduled since the last update, outside of any widget
+        std::optional<std::chrono::steady_clock::time_point> GetDeadline() const {
+            return Anim::GetEarlier(mNextDeadline, mTimers.GetNextDeadline());
+        }
+
+        std::optional<std::chrono::steady_clock::time_point> GetWallDeadline() const {
+            auto deadline = GetDeadline();
+
+            if (deadline.has_value() == false) {
+                return std::nullopt;
+            }
+
+            return mClock.ToWallTime(deadline.value());
+        }
+
+        uint64_t GetStructureRevision() const {
+            uint64_t revision = mStructureRevision;
+
+            for (const auto& panel : mPanels) {
+                revision += panel->GetStructureRevision();
+            }
+
+            for (const auto& scene : mScenes) {
+                revision += scene->GetStructureRevision();
+            }
+
+            return revision;
+        }
+
+        // Counted over what this context shows only, so activity in another context never keeps it awake
+        uint64_t GetChangeCount() const {
+            uint64_t changes = mFocus.GetChangeCount() + mScheduler.GetChangeCount();
+
+            for (const auto& panel : mPanels) {
+                changes += panel->GetChangeCount();
+            }
+
+            for (const auto& scene : mScenes) {
+                changes += scene->GetChangeCount();
+            }
+
+            return changes;
+        }
+
+        void AppendFocusOrder(const std::shared_ptr<Widget>& widget) {
+            if (widget->IsFocusable() == true) {
+                mFocus.AppendOrder(widget);
+            }
+
+            for (const auto& child : widget->GetChildren()) {
+                AppendFocusOrder(child);
+            }
+        }
+
+        // Tab order follows registration: standalone panels first, then scenes, widgets in insertion order
+        // with the children of a container right after it
+        void RebuildFocusOrder(uint64_t revision) {
+            mFocus.ClearOrder();
+
+            auto append_panel = [this](const Panel& panel) {
+                for (const auto& widget : panel.GetWidgets()) {
+                    AppendFocusOrder(widget);
+                }
+            };
+
+            for (const auto& panel : mPanels) {
+                append_panel(*panel);
+            }
+
+            for (const auto& scene : mScenes) {
+                for (const auto& panel : scene->GetPanels()) {
+                    append_panel(*panel);
+                }
+            }
+
+            mFocus.SetOrderRevision(revision);
+        }
+
+        void RefreshFocusOrder() {
+            uint64_t revision = GetStructureRevision();
+
+            if (mFocus.IsOrderStale(revision) == true) {
+                RebuildFocusOrder(revision);
+            }
+        }
+
+        // Scenes render above standalone panels, so a later hit wins
+        std::shared_ptr<Widget> FindFocusAt(sf::Vector2f position) {
+            std::shared_ptr<Widget> hit;
+
+            for (const auto& panel : mPanels) {
+                if (auto panel_hit = panel->FindFocusAt(position); panel_hit != nullptr) {
+                    hit = panel_hit;
+                }
+            }
+
+            for (const auto& scene : mScenes) {
+                if (auto scene_hit = scene->FindFocusAt(position); scene_hit != nullptr) {
+                    hit = scene_hit;
+                }
+            }
+
+            return hit;
+        }
+
+        // Focus moves at each left press in the queue, so every key reaches the widget focused when it was typed
+        void UpdateFocus(const Controls& controls) {
+            std::shared_ptr<Widget> focused = mFocus.GetFocused();
+
+            if (focused != nullptr && focused->GetVisibility() == false) {
+                mFocus.ClearFocus();
+
+                focused.reset();
+            }
+
+            for (const InputEvent& event : controls.mEvents) {
+                if (event.mType == InputType::MousePressed && event.mButton == sf::Mouse::Button::Left) {
+                    mFocus.SetFocus(FindFocusAt(event.mPosition));
+
+                    focused = mFocus.GetFocused();
+
+                    continue;
+                }
+
+                if (event.mType == InputType::KeyPressed && event.mKey == sf::Keyboard::Key::Tab) {
+                    RefreshFocusOrder();
+
+                    mFocus.FocusNext(event.mIsSPressed);
+
+                    focused = mFocus.GetFocused();
+
+                    continue;
+                }
+
+                bool is_keyboard = event.mType == InputType::TextEntered || event.mType == InputType::KeyPressed || event.mType == InputType::KeyReleased;
+
+                if (focused != nullptr && is_keyboard == true) {
+                    focused->HandleKeyEvent(event);
+                }
+            }
+
+            if (focused != nullptr) {
+                mNextDeadline = Anim::GetEarlier(mNextDeadline, focused->GetNextDeadline());
+            }
+        }
 
     public:
-        UIContext() = default;
+        UIContext() {
+            mTimers.SetClock(&mClock);
+        }
 
         void ShowPanelList() const {
             std::cout << "UI Panels Listing\n";
@@ -653,25 +1656,163 @@ namespace Orbis {
 
         void AddPanel(std::shared_ptr<Panel> panel) {
             mPanels.push_back(panel);
+
+            ++mStructureRevision;
+
+            mIsInvalidated = true;
         }
 
         void AddScene(std::shared_ptr<Scene> scene) {
             mScenes.push_back(scene);
+
+            ++mStructureRevision;
+
+            mIsInvalidated = true;
+        }
+
+        ResourceVault& GetResourceVault() {
+            return mResourceVault;
+        }
+
+        // Pause, slow down or step the whole context; animations, timers and the cursor blink all follow it
+        Clock& GetClock() {
+            return mClock;
+        }
+
+        AnimationScheduler& GetAnimationScheduler() {
+            return mScheduler;
         }
 
-        void Update(const Controls& controls) {
-            mControls = controls;
+        // Starts a timeline on the context clock, from where that clock stands now
+        void Play(const std::shared_ptr<Timeline>& timeline) {
+            mScheduler.Play(timeline, mClock.GetCurrentTime());
+        }
+
+        // Callbacks run from Update(), on the context clock, so they pause and slow down with everything else
+        TimerWheel& GetTimers() {
+            return mTimers;
+        }
+
+        std::shared_ptr<Widget> GetFocused() const {
+            return mFocus.GetFocused();
+        }
+
+        void SetFocus(std::shared_ptr<Widget> widget) {
+            ClockScope scope(mClock);
+
+            mFocus.SetFocus(widget);
+        }
+
+        void ClearFocus() {
+            ClockScope scope(mClock);
+
+            mFocus.ClearFocus();
+        }
+
+        void FocusNext(bool is_reverse = false) {
+            ClockScope scope(mClock);
+
+            RefreshFocusOrder();
+
+            mFocus.FocusNext(is_reverse);
+        }
+
+        bool IsEventDriven() const {
+            return mIsEventDriven;
+        }
+
+        // When enabled, Update() skips frames without input, animation, due deadlines or UI mutations.
+        void SetEventDriven(bool is_event_driven) {
+            mIsEventDriven = is_event_driven;
+            mIsInvalidated = true;
+        }
+
+        // Forces the next frame to run, e.g. after writing into a drawing obtained through Get*() earlier
+        void Invalidate() {
+            mIsInvalidated = true;
+        }
+
+        bool CanSkipFrame(bool has_input) const {
+            if (mIsEventDriven == false || has_input == true || mIsInvalidated == true || mIsAnimating == true) {
+                return false;
+            }
+
+            if (mChangesSeen != GetChangeCount()) {
+                return false;
+            }
+
+            auto deadline = GetDeadline();
+
+            return deadline.has_value() == false || mClock.Peek() < deadline.value();
+        }
+
+        FrameStatus Update(const Controls& controls, bool has_input = true) {
+            FrameStatus status;
+
+            if (CanSkipFrame(has_input) == true) {
+                status.mIsSkipped    = true;
+                status.mNeedsRedraw  = false;
+                status.mNextDeadline = GetWallDeadline();
+
+                return status;
+            }
+
+            ClockScope scope(mClock);
+
+            auto now             = mClock.Tick();
+            auto deadline        = GetDeadline();
+            bool is_deadline_due = deadline.has_value() == true && deadline.value() <= now;
+
+            mIsAnimating = false;
+            mNextDeadline.reset();
+
+            // Values land before input is dispatched, so hit testing sees where things are drawn this frame
+            mScheduler.Advance(now);
+            mTimers.Advance(now);
 
             for (auto& panel : mPanels) {
-                panel->Update(mControls);
+                panel->Update(controls, mScheduler);
+
+                if (panel->IsAnimating() == true) {
+                    mIsAnimating = true;
+                }
+
+                mNextDeadline = Anim::GetEarlier(mNextDeadline, panel->GetNextDeadline());
             }
 
             for (auto& scene : mScenes) {
-                scene->Update(mControls);
+                scene->Update(controls, mScheduler);
+
+                if (scene->IsAnimating() == true) {
+                    mIsAnimating = true;
+                }
+
+                mNextDeadline = Anim::GetEarlier(mNextDeadline, scene->GetNextDeadline());
             }
+
+            UpdateFocus(controls);
+
+            if (mScheduler.IsRunning() == true) {
+                mIsAnimating = true;
+            }
+
+            mNextDeadline = Anim::GetEarlier(mNextDeadline, mScheduler.GetNextDeadline());
+
+            uint64_t changes = GetChangeCount();
+
+            // A due deadline means something changes with time alone, like a cursor blink
+            status.mNeedsRedraw  = mIsEventDriven == false || mIsInvalidated == true || mIsAnimating == true || is_deadline_due == true || changes != mChangesSeen;
+            status.mNextDeadline = mIsAnimating == true ? std::chrono::steady_clock::now() : GetWallDeadline();
+
+            mChangesSeen   = changes;
+            mIsInvalidated = false;
+
+            return status;
         }
 
         void Render(sf::RenderWindow& window) {
+            ClockScope scope(mClock);
+
             for (auto& panel : mPanels) {
                 panel->Render(window);
             }
@@ -682,12 +1823,28 @@ namespace Orbis {
         }
     };
 
+    // Windows may be driven from separate threads, one thread per window/context pair.
+    // The window table is guarded by a shared mutex, and each window's input is double-buffered
+    // so events can be pushed from the polling thread while the window's own thread updates.
+    // Window states are shared, so one unbound mid-frame stays alive until that frame is done.
+    // Panels and widgets are not synchronized: don't share them between contexts updated concurrently.
     class UI {
     private:
-        ResourceVault                                     mResourceVault;
-        std::unordered_map<sf::RenderWindow*, UIContext*> mWindowToContext;
-        std::unordered_map<sf::RenderWindow*, Mouse>      mMouseBuffers;
-        std::unordered_map<sf::RenderWindow*, Keyboard>   mKeyboardBuffers;
+        struct WindowState {
+            std::mutex                     mMutex; // guards the two below, held for a whole Update() or Render()
+            UIContext*                     mContext = nullptr;
+            std::unique_ptr<InputRecorder> mRecorder;
+
+            std::mutex mInputMutex;
+            Controls   mInputPending; // filled by ProcessEvent()
+            Controls   mInputFrame;   // snapshot handed to the context by Update()
+            bool       mHasPendingInput = false;
+            bool       mIsInvalidated   = false; // passed on to the context by the next Update()
+        };
+
+        ResourceVault                                                       mResourceVault;
+        std::unordered_map<sf::RenderWindow*, std::shared_ptr<WindowState>> mWindows;
+        std::shared_mutex                                                   mWindowsMutex;
 
         static UI& GetInstance() {
             static UI instance;
@@ -697,6 +1854,52 @@ namespace Orbis {
 
         UI() = default;
 
+        std::shared_ptr<WindowState> GetWindowState(sf::RenderWindow& window) {
+            {
+                std::shared_lock<std::shared_mutex> lock(mWindowsMutex);
+
+                auto iter = mWindows.find(&window);
+
+                if (iter != mWindows.end()) {
+                    return iter->second;
+                }
+            }
+
+            std::unique_lock<std::shared_mutex> lock(mWindowsMutex);
+
+            auto& state = mWindows[&window];
+
+            if (state == nullptr) {
+                state = std::make_shared<WindowState>();
+            }
+
+            return state;
+        }
+
+        std::shared_ptr<WindowState> GetBoundState(sf::RenderWindow& window) {
+            std::shared_lock<std::shared_mutex> lock(mWindowsMutex);
+
+            auto iter = mWindows.find(&window);
+
+            if (iter == mWindows.end()) {
+                throw std::runtime_error("Window not bound to any UIContext");
+            }
+
+            return iter->second;
+        }
+
+        // Runs func on the window's context with the state locked, so the context can't be rebound meanwhile
+        template <typename Func>
+        static auto WithContext(WindowState& state, Func&& func) {
+            std::lock_guard<std::mutex> lock(state.mMutex);
+
+            if (state.mContext == nullptr) {
+                throw std::runtime_error("Window not bound to any UIContext");
+            }
+
+            return func(*state.mContext);
+        }
+
     public:
         UI(const UI&)            = delete;
         UI& operator=(const UI&) = delete;
@@ -706,7 +1909,17 @@ namespace Orbis {
         }
 
         static void Bind(sf::RenderWindow& window, UIContext& context) {
-            GetInstance().mWindowToContext[&window] = &context;
+            std::shared_ptr<WindowState> state = GetInstance().GetWindowState(window);
+            std::lock_guard<std::mutex>  lock(state->mMutex);
+
+            state->mContext = &context;
+        }
+
+        static void Unbind(sf::RenderWindow& window) {
+            auto&                               instance = GetInstance();
+            std::unique_lock<std::shared_mutex> lock(instance.mWindowsMutex);
+
+            instance.mWindows.erase(&window);
         }
 
         static std::shared_ptr<sf::Font> LoadFont(const std::string& path) {
@@ -717,6 +1930,18 @@ namespace Orbis {
             return GetInstance().mResourceVault.LoadTexture(path, smoothing_enabled, srgb_enabled, area);
         }
 
+        static GlyphPageStats WarmGlyphs(const std::string& path, const sf::String& characters, const std::vector<unsigned int>& font_sizes, bool is_bold = false) {
+            return GetInstance().mResourceVault.WarmGlyphs(path, characters, font_sizes, is_bold);
+        }
+
+        [[nodiscard]] static std::future<GlyphPageStats> WarmGlyphsAsync(const std::string& path, const sf::String& characters, const std::vector<unsigned int>& font_sizes, bool is_bold = false) {
+            return GetInstance().mResourceVault.WarmGlyphsAsync(path, characters, font_sizes, is_bold);
+        }
+
+        static size_t GetGlyphPageBytes() {
+            return GetInstance().mResourceVault.GetGlyphPageBytes();
+        }
+
         static UIContext CreateContext() {
             return UIContext();
         }
@@ -727,21 +1952,14 @@ namespace Orbis {
 
         template <WidgetType Type>
         static auto CreateWidget() {
-            if constexpr (Type == WidgetType::Canvas) {
-                return WidgetHandle<Canvas>(std::make_shared<Canvas>());
-            }
-            else if constexpr (Type == WidgetType::Button) {
-                return WidgetHandle<Button>(std::make_shared<Button>());
-            }
-            else if constexpr (Type == WidgetType::Slider) {
-                return WidgetHandle<Slider>(std::make_shared<Slider>());
-            }
-            else if constexpr (Type == WidgetType::TextboxSingle) {
-                return WidgetHandle<TextboxSingle>(std::make_shared<TextboxSingle>());
-            }
-            else {
-                static_assert(Type == WidgetType::Canvas || Type == WidgetType::Button || Type == WidgetType::Slider || Type == WidgetType::TextboxSingle, "Unknown widget type");
-            }
+            using WT = typename WidgetClass<Type>::Class;
+
+            return WidgetHandle<WT>(std::make_shared<WT>());
+        }
+
+        template <WidgetType Type>
+        static auto CreateWidgets(size_t count) {
+            return WidgetBatch<typename WidgetClass<Type>::Class>(count);
         }
 
         static SceneHandle CreateScene() {
@@ -749,48 +1967,101 @@ namespace Orbis {
         }
 
         static void ShowPanelList(sf::RenderWindow& window) {
-            auto& instance = GetInstance();
-            auto  iter     = instance.mWindowToContext.find(&window);
+            WithContext(*GetInstance().GetBoundState(window), [](UIContext& context) {
+                context.ShowPanelList();
+            });
+        }
 
-            if (iter == instance.mWindowToContext.end()) {
-                throw std::runtime_error("Window not bound to any UIContext");
-            }
+        static void ShowSceneList(sf::RenderWindow& window) {
+            WithContext(*GetInstance().GetBoundState(window), [](UIContext& context) {
+                context.ShowSceneList();
+            });
+        }
 
-            UIContext* context = iter->second;
+        // Takes effect on the window's next Update(), without waiting for a frame in progress
+        static void Invalidate(sf::RenderWindow& window) {
+            std::shared_ptr<WindowState> state = GetInstance().GetBoundState(window);
+            std::lock_guard<std::mutex>  lock(state->mInputMutex);
 
-            context->ShowPanelList();
+            state->mIsInvalidated = true;
         }
 
-        static void ShowSceneList(sf::RenderWindow& window) {
-            auto& instance = GetInstance();
-            auto  iter     = instance.mWindowToContext.find(&window);
+        // Records every frame's input for the window until stopped, see InputRecording for the format
+        static void StartRecording(sf::RenderWindow& window, const std::string& path) {
+            std::shared_ptr<WindowState> state = GetInstance().GetBoundState(window);
 
-            if (iter == instance.mWindowToContext.end()) {
-                throw std::runtime_error("Window not bound to any UIContext");
+            WithContext(*state, [&state, &path](UIContext& context) {
+                state->mRecorder = std::make_unique<InputRecorder>(path, context.GetClock().GetTime());
+            });
+        }
+
+        static void StopRecording(sf::RenderWindow& window) {
+            std::shared_ptr<WindowState> state = GetInstance().GetBoundState(window);
+            std::lock_guard<std::mutex>  lock(state->mMutex);
+
+            state->mRecorder.reset();
+        }
+
+        // Feeds a recording to the context frame by frame without a window, returns the number of frames replayed.
+        // The context clock is driven by the recorded frame times, continuing from its current time.
+        // Throws once the frames before a corrupt event have been replayed.
+        static size_t Replay(UIContext& context, const std::string& path) {
+            Clock&      clock     = context.GetClock();
+            ClockMode   mode_prev = clock.GetMode();
+            InputPlayer player(path, clock.GetTime());
+
+            clock.SetMode(ClockMode::Manual);
+
+            while (player.NextFrame() == true) {
+                clock.SetTime(player.GetFrameTime());
+
+                context.Update(player.GetControls(), player.HasInput());
             }
 
-            UIContext* context = iter->second;
+            clock.SetMode(mode_prev);
 
-            context->ShowSceneList();
+            if (player.IsCorrupt() == true) {
+                throw std::runtime_error("Corrupt input recording: " + path + " after frame " + std::to_string(player.GetFrameIndex()));
+            }
+
+            return player.GetFrameIndex();
         }
 
         static void ProcessEvent(sf::RenderWindow& window, const sf::Event& event) {
-            auto& instance = GetInstance();
-
-            auto iter_kb = instance.mKeyboardBuffers.find(&window);
+            std::shared_ptr<WindowState> state_shared = GetInstance().GetWindowState(window);
+            WindowState&                 state        = *state_shared;
+            std::lock_guard<std::mutex>  lock(state.mInputMutex);
 
-            if (iter_kb == instance.mKeyboardBuffers.end()) {
-                instance.mKeyboardBuffers[&window] = Keyboard();
+            bool is_input = event.is<sf::Event::TextEntered>() || event.is<sf::Event::KeyPressed>() || event.is<sf::Event::KeyReleased>() || event.is<sf::Event::MouseButtonPressed>() || event.is<sf::Event::MouseButtonReleased>() || event.is<sf::Event::MouseMoved>() || event.is<sf::Event::MouseWheelScrolled>() || event.is<sf::Event::MouseLeft>();
 
-                iter_kb = instance.mKeyboardBuffers.find(&window);
+            if (is_input == true) {
+                state.mHasPendingInput = true;
             }
+            else {
+                // Resize, focus changes and the like don't reach widgets, but the window contents must be redrawn
+                state.mIsInvalidated = true;
+            }
+
+            Controls&  controls = state.mInputPending;
+            Keyboard&  keyboard = controls.mKeyboard;
+            Mouse&     mouse    = controls.mMouse;
+            InputEvent input;
 
-            Keyboard& keyboard = iter_kb->second;
+            input.mTime       = std::chrono::steady_clock::now();
+            input.mIsCPressed = keyboard.mIsCPressed;
+            input.mIsSPressed = keyboard.mIsSPressed;
+            input.mIsAPressed = keyboard.mIsAPressed;
 
             if (const auto* text_entered = event.getIf<sf::Event::TextEntered>()) {
                 // Backspace=8, Tab=9, Enter=13, Delete=127
                 if (32 <= text_entered->unicode && text_entered->unicode != 127) {
                     keyboard.mTextEntered += text_entered->unicode;
+
+                    input.mType     = InputType::TextEntered;
+                    input.mPosition = mouse.mPosition;
+                    input.mUnicode  = text_entered->unicode;
+
+                    controls.mEvents.Push(input);
                 }
             }
             else if (const auto* key_pressed = event.getIf<sf::Event::KeyPressed>()) {
@@ -799,6 +2070,15 @@ namespace Orbis {
                 keyboard.mIsCPressed = key_pressed->control;
                 keyboard.mIsSPressed = key_pressed->shift;
                 keyboard.mIsAPressed = key_pressed->alt;
+
+                input.mType       = InputType::KeyPressed;
+                input.mPosition   = mouse.mPosition;
+                input.mKey        = key_pressed->code;
+                input.mIsCPressed = key_pressed->control;
+                input.mIsSPressed = key_pressed->shift;
+                input.mIsAPressed = key_pressed->alt;
+
+                controls.mEvents.Push(input);
             }
             else if (const auto* key_released = event.getIf<sf::Event::KeyReleased>()) {
                 keyboard.mKeysReleased.push_back(key_released->code);
@@ -806,19 +2086,39 @@ namespace Orbis {
                 keyboard.mIsCPressed = key_released->control;
                 keyboard.mIsSPressed = key_released->shift;
                 keyboard.mIsAPressed = key_released->alt;
-            }
 
-            auto iter_m = instance.mMouseBuffers.find(&window);
+                input.mType       = InputType::KeyReleased;
+                input.mPosition   = mouse.mPosition;
+                input.mKey        = key_released->code;
+                input.mIsCPressed = key_released->control;
+                input.mIsSPressed = key_released->shift;
+                input.mIsAPressed = key_released->alt;
+
+                controls.mEvents.Push(input);
+            }
+            else if (const auto* mouse_moved = event.getIf<sf::Event::MouseMoved>()) {
+                mouse.mPosition = sf::Vector2f(mouse_moved->position);
 
-            if (iter_m == instance.mMouseBuffers.end()) {
-                instance.mMouseBuffers[&window] = Mouse();
+                input.mType     = InputType::MouseMoved;
+                input.mPosition = mouse.mPosition;
 
-                iter_m = instance.mMouseBuffers.find(&window);
+                controls.mEvents.Push(input);
             }
+            else if (const auto* mouse_scrolled = event.getIf<sf::Event::MouseWheelScrolled>()) {
+                mouse.mPosition    = sf::Vector2f(mouse_scrolled->position);
+                mouse.mIsScrolling = true;
 
-            Mouse& mouse = iter_m->second;
+                mouse.mWheelDelta += mouse_scrolled->delta;
+
+                input.mType       = InputType::MouseWheel;
+                input.mPosition   = mouse.mPosition;
+                input.mWheelDelta = mouse_scrolled->delta;
+
+                controls.mEvents.Push(input);
+            }
+            else if (const auto* mouse_pressed = event.getIf<sf::Event::MouseButtonPressed>()) {
+                mouse.mPosition = sf::Vector2f(mouse_pressed->position);
 
-            if (const auto* mouse_pressed = event.getIf<sf::Event::MouseButtonPressed>()) {
                 mouse.mButtonsPressed.push_back(mouse_pressed->button);
 
                 switch (mouse_pressed->button) {
@@ -846,8 +2146,16 @@ namespace Orbis {
                         break;
                     }
                 }
+
+                input.mType     = InputType::MousePressed;
+                input.mPosition = mouse.mPosition;
+                input.mButton   = mouse_pressed->button;
+
+                controls.mEvents.Push(input);
             }
             else if (const auto* mouse_released = event.getIf<sf::Event::MouseButtonReleased>()) {
+                mouse.mPosition = sf::Vector2f(mouse_released->position);
+
                 mouse.mButtonsReleased.push_back(mouse_released->button);
 
                 switch (mouse_released->button) {
@@ -875,41 +2183,53 @@ namespace Orbis {
                         break;
                     }
                 }
+
+                input.mType     = InputType::MouseReleased;
+                input.mPosition = mouse.mPosition;
+                input.mButton   = mouse_released->button;
+
+                controls.mEvents.Push(input);
             }
         }
 
-        static void Update(sf::RenderWindow& window) {
-            auto& instance = GetInstance();
-            auto  iter     = instance.mWindowToContext.find(&window);
+        static FrameStatus Update(sf::RenderWindow& window) {
+            std::shared_ptr<WindowState> state_shared   = GetInstance().GetBoundState(window);
+            WindowState&                 state          = *state_shared;
+            bool                         has_input      = false;
+            bool                         is_invalidated = false;
 
-            if (iter == instance.mWindowToContext.end()) {
-                throw std::runtime_error("Window not bound to any UIContext");
+            {
+                std::lock_guard<std::mutex> lock(state.mInputMutex);
+
+                state.mInputFrame = state.mInputPending;
+                has_input         = state.mHasPendingInput;
+                is_invalidated    = state.mIsInvalidated;
+
+                state.mInputPending.ClearFrameEvents();
+                state.mHasPendingInput = false;
+                state.mIsInvalidated   = false;
             }
 
-            UIContext* context = iter->second;
-            Controls   controls;
+            return WithContext(state, [&state, has_input, is_invalidated](UIContext& context) {
+                if (is_invalidated == true) {
+                    context.Invalidate();
+                }
 
-            controls.mMouse             = instance.mMouseBuffers[&window];
-            controls.mKeyboard          = instance.mKeyboardBuffers[&window];
-            controls.mMouse.mPosition.x = static_cast<float>(sf::Mouse::getPosition(window).x);
-            controls.mMouse.mPosition.y = static_cast<float>(sf::Mouse::getPosition(window).y);
+                FrameStatus status = context.Update(state.mInputFrame, has_input);
 
-            instance.mMouseBuffers[&window].ClearFrameEvents();
-            instance.mKeyboardBuffers[&window].ClearFrameEvents();
+                // After the update, so the frame is stamped with the time the context actually used
+                if (state.mRecorder != nullptr) {
+                    state.mRecorder->RecordFrame(state.mInputFrame, has_input, context.GetClock().GetTime());
+                }
 
-            context->Update(controls);
+                return status;
+            });
         }
 
         static void Render(sf::RenderWindow& window) {
-            auto& instance = GetInstance();
-            auto  iter     = instance.mWindowToContext.find(&window);
-
-            if (iter == instance.mWindowToContext.end()) {
-                throw std::runtime_error("Window not bound to any UIContext");
-            }
-
-            UIContext* context = iter->second;
-            context->Render(window);
+            WithContext(*GetInstance().GetBoundState(window), [&window](UIContext& context) {
+                context.Render(window);
+            });
         }
     };
 
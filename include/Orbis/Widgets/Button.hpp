@@ -18,6 +18,26 @@ namespace Orbis {
 
         bool mWasPressed = false;
 
+        static sf::Color ModifyColor(const Widget& widget, DrawingType type, const sf::Color& original) {
+            sf::Color state = static_cast<const Button&>(widget).GetStateColor();
+
+            if (type == DrawingType::Rect) {
+                return state;
+            }
+            else if (type == DrawingType::Texture || type == DrawingType::Sprite) {
+                sf::Color blended = original;
+
+                blended.r = (blended.r * state.r) / 255;
+                blended.g = (blended.g * state.g) / 255;
+                blended.b = (blended.b * state.b) / 255;
+                blended.a = (blended.a * state.a) / 255;
+
+                return blended;
+            }
+
+            return original;
+        }
+
     public:
         Button() = default;
 
@@ -61,6 +81,8 @@ namespace Orbis {
                 }
             }
 
+            MarkChanged();
+
             return *this;
         }
 
@@ -83,44 +105,64 @@ namespace Orbis {
             return cloned;
         }
 
-        void UpdateImpl(const Controls& controls, sf::Vector2f pos_panel) override {
-            UpdateAnimation();
+        bool HasCapture() const override {
+            return mWasPressed;
+        }
 
+        void UpdateImpl(const Controls& controls, sf::Vector2f pos_panel) override {
             if (mIsVisible == false) {
                 return;
             }
 
             sf::Vector2f  pos_global = pos_panel + mPosition;
             sf::FloatRect bounds(pos_global, mSize);
+            ButtonState   state_prev = mState;
 
-            bool is_hovered = bounds.contains(controls.mMouse.mPosition);
+            // Walk the frame's events in order so a press and release within one frame still count as a click
+            for (const InputEvent& event : controls.mEvents) {
+                if (event.mButton != sf::Mouse::Button::Left) {
+                    continue;
+                }
 
-            if (is_hovered == true) {
-                if (controls.mMouse.mIsLPressed == true) {
-                    mState      = ButtonState::Pressed;
-                    mWasPressed = true;
+                if (event.mType == InputType::MousePressed) {
+                    if (bounds.contains(event.mPosition) == true) {
+                        mWasPressed = true;
+                    }
                 }
-                else {
-                    if (mWasPressed == true) {
+                else if (event.mType == InputType::MouseReleased) {
+                    if (mWasPressed == true && bounds.contains(event.mPosition) == true) {
                         if (mOnButtonPressed) {
                             mOnButtonPressed();
                         }
-
-                        mWasPressed = false;
                     }
 
+                    mWasPressed = false;
+                }
+            }
+
+            bool is_hovered = bounds.contains(controls.mMouse.mPosition);
+
+            if (is_hovered == true) {
+                if (mWasPressed == true) {
+                    mState = ButtonState::Pressed;
+                }
+                else {
                     mState = ButtonState::Hover;
                 }
             }
             else {
                 mState = ButtonState::Normal;
+            }
 
-                if (controls.mMouse.mIsLPressed == false) {
-                    mWasPressed = false;
-                }
+            if (mState != state_prev) {
+                MarkChanged();
             }
         }
 
+        bool IsQuadBatchable() const override {
+            return true;
+        }
+
         void RenderImpl(sf::RenderWindow& window, sf::Vector2f pos_panel) override {
             if (mIsVisible == false) {
                 return;
@@ -128,26 +170,7 @@ namespace Orbis {
 
             sf::Vector2f pos_global = pos_panel + mPosition;
 
-            auto color_mod = [this](DrawingType type, const sf::Color& original) -> sf::Color {
-                if (type == DrawingType::Rect) {
-                    return GetStateColor();
-                }
-                else if (type == DrawingType::Texture) {
-                    sf::Color state   = GetStateColor();
-                    sf::Color blended = original;
-
-                    blended.r = (blended.r * state.r) / 255;
-                    blended.g = (blended.g * state.g) / 255;
-                    blended.b = (blended.b * state.b) / 255;
-                    blended.a = (blended.a * state.a) / 255;
-
-                    return blended;
-                }
-
-                return original;
-            };
-
-            RenderAllDrawings(window, pos_global, color_mod);
+            RenderAllDrawings(window, pos_global, &Button::ModifyColor);
         }
     };
 } // namespace Orbis
\ No newline at end of file
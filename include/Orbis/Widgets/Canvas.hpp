@@ -22,12 +22,14 @@ namespace Orbis {
         }
 
         void UpdateImpl(const Controls& controls, sf::Vector2f pos_panel) override {
-            UpdateAnimation();
-
             (void)controls;
             (void)pos_panel;
         }
 
+        bool IsQuadBatchable() const override {
+            return true;
+        }
+
         void RenderImpl(sf::RenderWindow& window, sf::Vector2f pos_panel) override {
             if (mIsVisible == false) {
                 return;
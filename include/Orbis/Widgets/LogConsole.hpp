@@ -0,0 +1,396 @@
+#pragma once
+
+#include <algorithm>
+#include <deque>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "Orbis/System/GlyphRun.hpp"
+#include "Orbis/Widgets/Widget.hpp"
+
+namespace Orbis {
+    // Read-only console for streamed log lines. Lines live in a ring of fixed capacity, oldest dropped first, and each
+    // keeps its own GlyphRun, laid out the first time it scrolls into view. An append only writes its own slot, so a
+    // burst of thousands of lines costs no more to draw than the few that end up on screen.
+    class LogConsole : public Widget {
+    private:
+        struct Line {
+            std::u32string           mText;
+            std::optional<sf::Color> mColor; // the style drawing's color when unset
+            GlyphRun                 mRun;
+            bool                     mIsLaidOut = false;
+        };
+
+        std::vector<Line> mLines;        // ring, grows up to mCapacity and then reuses the oldest slot
+        size_t            mCapacity = 10000;
+        size_t            mHead     = 0; // slot of mFirstSeq
+        uint64_t          mFirstSeq = 0; // sequence number of the oldest line kept
+        uint64_t          mEndSeq   = 0; // one past the newest
+
+        // Sequence numbers of the lines passing the filter, ascending; unused while the filter is empty
+        std::u32string       mFilter;
+        std::deque<uint64_t> mShown;
+
+        std::string mIDStyle         = ""; // text drawing whose font, size, color and position the lines take
+        uint64_t    mTopSeq          = 0;  // first line in view while not stuck to the bottom
+        bool        mIsStuckToBottom = true;
+        size_t      mScrollStep      = 3; // lines per wheel notch
+        float       mPadding         = 0.0f;
+
+        std::shared_ptr<sf::Font> mRunFont;
+        size_t                    mRunFontSize = 0;
+
+        struct Style {
+            std::shared_ptr<sf::Font> mFont;
+            size_t                    mFontSize  = 0;
+            sf::Color                 mFillColor = sf::Color::White;
+            sf::Vector2f              mPosition  = {0, 0};
+        };
+
+        // Either a DrawingsText or a DrawingsWText; its own string is never drawn
+        bool GetStyle(Style& style) const {
+            if (auto iter = mDrawingsText.find(mIDStyle); iter != mDrawingsText.end()) {
+                style = {iter->second->mFont, iter->second->mFontSize, iter->second->mFillColor, iter->second->mPosition};
+            }
+            else if (auto iter_w = mDrawingsWText.find(mIDStyle); iter_w != mDrawingsWText.end()) {
+                style = {iter_w->second->mFont, iter_w->second->mFontSize, iter_w->second->mFillColor, iter_w->second->mPosition};
+            }
+            else {
+                return false;
+            }
+
+            return style.mFont != nullptr;
+        }
+
+        size_t GetKeptCount() const {
+            return static_cast<size_t>(mEndSeq - mFirstSeq);
+        }
+
+        Line& GetLine(uint64_t seq) {
+            return mLines[(mHead + static_cast<size_t>(seq - mFirstSeq)) % mLines.size()];
+        }
+
+        bool IsShown(const std::u32string& text) const {
+            return mFilter.empty() == true || text.find(mFilter) != std::u32string::npos;
+        }
+
+        size_t GetShownCount() const {
+            return mFilter.empty() == true ? GetKeptCount() : mShown.size();
+        }
+
+        uint64_t GetShownSeq(size_t index) const {
+            return mFilter.empty() == true ? mFirstSeq + index : mShown[index];
+        }
+
+        // Index among the shown lines of the first one at or after seq
+        size_t GetShownIndex(uint64_t seq) const {
+            if (mFilter.empty() == true) {
+                return static_cast<size_t>(std::max(seq, mFirstSeq) - mFirstSeq);
+            }
+
+            return static_cast<size_t>(std::lower_bound(mShown.begin(), mShown.end(), seq) - mShown.begin());
+        }
+
+        size_t GetVisibleLineCount(const Style& style) const {
+            float line_height = std::max(style.mFont->getLineSpacing(static_cast<unsigned int>(style.mFontSize)), 1.0f);
+            float height      = mSize.y - style.mPosition.y - 2 * mPadding;
+
+            return std::max(static_cast<size_t>(std::max(height, 0.0f) / line_height), size_t(1));
+        }
+
+        // First shown line in view; stuck to the bottom it follows the newest line
+        size_t GetTopIndex(size_t visible) const {
+            size_t shown   = GetShownCount();
+            size_t top_max = visible < shown ? shown - visible : 0;
+
+            if (mIsStuckToBottom == true) {
+                return top_max;
+            }
+
+            return std::min(GetShownIndex(mTopSeq), top_max);
+        }
+
+        void DropOldest() {
+            if (mShown.empty() == false && mShown.front() == mFirstSeq) {
+                mShown.pop_front();
+            }
+
+            mHead = (mHead + 1) % mLines.size();
+
+            ++mFirstSeq;
+        }
+
+        void PushLine(std::u32string_view text, std::optional<sf::Color> color) {
+            if (mCapacity == 0) {
+                return;
+            }
+
+            if (GetKeptCount() == mCapacity) {
+                DropOldest();
+            }
+
+            if (mLines.size() == GetKeptCount()) {
+                mLines.emplace_back();
+            }
+
+            // A reused slot keeps its buffers, so a full console appends without allocating
+            Line& line = GetLine(mEndSeq);
+
+            line.mText.assign(text.begin(), text.end());
+            line.mColor     = color;
+            line.mIsLaidOut = false;
+
+            if (mFilter.empty() == false && IsShown(line.mText) == true) {
+                mShown.push_back(mEndSeq);
+            }
+
+            ++mEndSeq;
+        }
+
+        void RebuildShown() {
+            mShown.clear();
+
+            if (mFilter.empty() == true) {
+                return;
+            }
+
+            for (uint64_t seq = mFirstSeq; seq < mEndSeq; ++seq) {
+                if (IsShown(GetLine(seq).mText) == true) {
+                    mShown.push_back(seq);
+                }
+            }
+        }
+
+        // Moves the oldest line to slot 0, so the ring can change size
+        void Unwrap() {
+            std::rotate(mLines.begin(), mLines.begin() + static_cast<ptrdiff_t>(mHead), mLines.end());
+
+            mLines.resize(GetKeptCount());
+
+            mHead = 0;
+        }
+
+        void ScrollBy(ptrdiff_t lines, size_t visible) {
+            size_t shown   = GetShownCount();
+            size_t top_max = visible < shown ? shown - visible : 0;
+            size_t top     = GetTopIndex(visible);
+
+            if (lines < 0) {
+                top = top - std::min(top, static_cast<size_t>(-lines));
+            }
+            else {
+                top = std::min(top + static_cast<size_t>(lines), top_max);
+            }
+
+            mIsStuckToBottom = top == top_max;
+            mTopSeq          = top < shown ? GetShownSeq(top) : mEndSeq;
+        }
+
+    public:
+        LogConsole() = default;
+
+        // Number of lines kept, filtered out ones included
+        size_t GetLineCount() const {
+            return GetKeptCount();
+        }
+
+        size_t GetShownLineCount() const {
+            return GetShownCount();
+        }
+
+        bool IsStuckToBottom() const {
+            return mIsStuckToBottom;
+        }
+
+        // One line per '\n'; only the new lines are touched, and they are laid out once they scroll into view
+        LogConsole& Append(const sf::String& text, std::optional<sf::Color> color = std::nullopt) {
+            // Split straight out of the string's own storage, without a UTF-32 copy of the whole burst
+            std::u32string_view utf32(text.getData(), text.getSize());
+            size_t              start = 0;
+
+            for (size_t end = utf32.find(U'\n'); end != std::u32string_view::npos; end = utf32.find(U'\n', start)) {
+                PushLine(utf32.substr(start, end - start), color);
+
+                start = end + 1;
+            }
+
+            PushLine(utf32.substr(start), color);
+
+            MarkChanged();
+
+            return *this;
+        }
+
+        LogConsole& Clear() {
+            mFirstSeq = mEndSeq;
+            mHead     = 0;
+
+            mShown.clear();
+
+            MarkChanged();
+
+            return *this;
+        }
+
+        // Oldest lines beyond the new capacity are dropped
+        LogConsole& SetCapacity(size_t lines) {
+            Unwrap();
+
+            if (lines < mLines.size()) {
+                size_t dropped = mLines.size() - lines;
+
+                mLines.erase(mLines.begin(), mLines.begin() + static_cast<ptrdiff_t>(dropped));
+
+                mFirstSeq += dropped;
+            }
+
+            mCapacity = lines;
+
+            RebuildShown();
+
+            MarkChanged();
+
+            return *this;
+        }
+
+        // Shows only the lines containing needle, case-sensitive; an empty needle shows everything
+        LogConsole& SetFilter(const sf::String& needle) {
+            mFilter = needle.toUtf32();
+
+            RebuildShown();
+
+            MarkChanged();
+
+            return *this;
+        }
+
+        LogConsole& SetLineStyle(const std::string& text_id) {
+            mIDStyle = text_id;
+
+            MarkChanged();
+
+            return *this;
+        }
+
+        LogConsole& SetPadding(float padding) {
+            mPadding = padding;
+
+            MarkChanged();
+
+            return *this;
+        }
+
+        LogConsole& SetScrollStep(size_t lines) {
+            mScrollStep = lines;
+
+            return *this;
+        }
+
+        LogConsole& ScrollToBottom() {
+            mIsStuckToBottom = true;
+
+            MarkChanged();
+
+            return *this;
+        }
+
+        std::shared_ptr<Widget> CloneImpl() const override {
+            auto cloned = std::make_shared<LogConsole>();
+
+            cloned->mSize            = mSize;
+            cloned->mPosition        = mPosition;
+            cloned->mZLevel          = mZLevel;
+            cloned->mIsVisible       = mIsVisible;
+            cloned->mLines           = mLines;
+            cloned->mCapacity        = mCapacity;
+            cloned->mHead            = mHead;
+            cloned->mFirstSeq        = mFirstSeq;
+            cloned->mEndSeq          = mEndSeq;
+            cloned->mFilter          = mFilter;
+            cloned->mShown           = mShown;
+            cloned->mIDStyle         = mIDStyle;
+            cloned->mTopSeq          = mTopSeq;
+            cloned->mIsStuckToBottom = mIsStuckToBottom;
+            cloned->mScrollStep      = mScrollStep;
+            cloned->mPadding         = mPadding;
+
+            CloneDrawingsTo(cloned.get());
+
+            return cloned;
+        }
+
+        // Wheel only; scrolling up leaves the bottom, scrolling back down to it sticks again
+        void UpdateImpl(const Controls& controls, sf::Vector2f pos_panel) override {
+            Style style;
+
+            if (mIsVisible == false || GetStyle(style) == false) {
+                return;
+            }
+
+            sf::FloatRect bounds(pos_panel + mPosition, mSize);
+            size_t        visible  = GetVisibleLineCount(style);
+            size_t        top_prev = GetTopIndex(visible);
+            bool          is_stuck = mIsStuckToBottom;
+
+            for (const InputEvent& event : controls.mEvents) {
+                if (event.mType != InputType::MouseWheel || bounds.contains(event.mPosition) == false) {
+                    continue;
+                }
+
+                ScrollBy(static_cast<ptrdiff_t>(-event.mWheelDelta * static_cast<float>(mScrollStep)), visible);
+            }
+
+            if (GetTopIndex(visible) != top_prev || mIsStuckToBottom != is_stuck) {
+                MarkChanged();
+            }
+        }
+
+        // Lays out and draws only the lines in view, each clipped to the box sideways
+        void RenderImpl(sf::RenderWindow& window, sf::Vector2f pos_panel) override {
+            if (mIsVisible == false) {
+                return;
+            }
+
+            sf::Vector2f pos_global = pos_panel + mPosition;
+
+            RenderAllDrawingsSkipEditable(window, pos_global, mIDStyle);
+
+            Style style;
+
+            if (GetStyle(style) == false) {
+                return;
+            }
+
+            // A new font or size lays every line out again as it comes into view
+            if (style.mFont != mRunFont || style.mFontSize != mRunFontSize) {
+                mRunFont     = style.mFont;
+                mRunFontSize = style.mFontSize;
+
+                for (Line& line : mLines) {
+                    line.mIsLaidOut = false;
+                }
+            }
+
+            size_t visible     = GetVisibleLineCount(style);
+            size_t top         = GetTopIndex(visible);
+            size_t bottom      = std::min(top + visible, GetShownCount());
+            float  line_height = std::max(style.mFont->getLineSpacing(static_cast<unsigned int>(style.mFontSize)), 1.0f);
+            float  clip_right  = mSize.x - style.mPosition.x - 2 * mPadding;
+
+            sf::Vector2f origin = pos_global + style.mPosition + sf::Vector2f(mPadding, mPadding);
+
+            for (size_t index = top; index < bottom; ++index) {
+                Line& line = GetLine(GetShownSeq(index));
+
+                if (line.mIsLaidOut == false) {
+                    line.mRun.Assign(line.mText, line.mText.size(), mRunFont, mRunFontSize);
+                    line.mIsLaidOut = true;
+                }
+
+                line.mRun.SetColor(line.mColor.value_or(style.mFillColor));
+                line.mRun.Draw(window, {origin.x, origin.y + static_cast<float>(index - top) * line_height}, 0.0f, clip_right);
+            }
+        }
+    };
+} // namespace Orbis
\ No newline at end of file
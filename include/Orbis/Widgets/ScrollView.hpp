@@ -0,0 +1,455 @@
+#pragma once
+
+#include <algorithm>
+#include <limits>
+#include <span>
+#include <vector>
+
+#include "Orbis/SFML/Shapes.hpp"
+#include "Orbis/System/SpatialGrid.hpp"
+#include "Orbis/Widgets/Widget.hpp"
+
+namespace Orbis {
+    // Clips its children to its own bounds, and only updates and renders those intersecting the viewport.
+    // Children are positioned in content space; the scroll offset lives in the view used to draw them.
+    class ScrollView : public Widget {
+    private:
+        std::vector<std::shared_ptr<Widget>> mChildren;
+        std::vector<uint32_t>                mChildRevisions;
+        std::vector<uint32_t>                mVisible;  // children intersecting the viewport, in zlevel order
+        std::vector<uint32_t>                mCaptured; // children still capturing input after the last update
+        std::vector<uint32_t>                mDispatch;
+        std::vector<uint32_t>                mFocusHits;
+        SpatialGrid                          mContentGrid;
+        uint64_t                             mStructureRevision = 0; // bumped when children are added
+        uint64_t                             mChangesSeen       = UINT64_MAX;
+        uint64_t                             mSubmitsSeen       = UINT64_MAX;
+        bool                                 mIsContentDirty    = true;
+
+        // Mutations of the children only, carried on to the panel's counter
+        std::shared_ptr<ChangeCounter> mChildChanges = std::make_shared<ChangeCounter>();
+
+        Controls mClipped; // this frame's input without pointer events outside the viewport
+
+        sf::Vector2f mContentSize  = {0, 0};
+        sf::Vector2f mScrollOffset = {0, 0};
+        float        mScrollStep   = 40.0f;
+
+        std::optional<std::chrono::steady_clock::time_point> mNextDeadline;
+
+        void GrowContent(sf::FloatRect bounds) {
+            mContentSize.x = std::max(mContentSize.x, bounds.position.x + bounds.size.x);
+            mContentSize.y = std::max(mContentSize.y, bounds.position.y + bounds.size.y);
+        }
+
+        // Children moving through setters or the scheduler bump their counter, so the view only walks them after that
+        void RefreshChildren() {
+            if (mIsContentDirty == false && mChangesSeen == mChildChanges->Get()) {
+                return;
+            }
+
+            mChildRevisions.resize(mChildren.size(), UINT32_MAX);
+
+            mContentSize = {0, 0};
+
+            for (const auto& child : mChildren) {
+                GrowContent(child->GetHitBounds());
+            }
+
+            // The grid only covers what it's laid out for, so it's laid out again ahead of growing content
+            sf::Vector2f area = mContentGrid.GetArea().size;
+
+            if (area.x < mContentSize.x || area.y < mContentSize.y) {
+                mContentGrid.SetArea({{0, 0}, {std::max(area.x, 2 * mContentSize.x), std::max(area.y, 2 * mContentSize.y)}});
+                mChildRevisions.assign(mChildren.size(), UINT32_MAX);
+            }
+
+            for (uint32_t i = 0; i < mChildren.size(); ++i) {
+                Widget& child = *mChildren[i];
+
+                if (mChildRevisions[i] != child.GetRevision()) {
+                    mContentGrid.Update(i, child.GetHitBounds());
+
+                    mChildRevisions[i] = child.GetRevision();
+                }
+            }
+
+            mIsContentDirty = false;
+            mChangesSeen    = mChildChanges->Get();
+        }
+
+        sf::Vector2f ClampOffset(sf::Vector2f offset) const {
+            sf::Vector2f offset_max = {std::max(0.0f, mContentSize.x - mSize.x), std::max(0.0f, mContentSize.y - mSize.y)};
+
+            return {std::clamp(offset.x, 0.0f, offset_max.x), std::clamp(offset.y, 0.0f, offset_max.y)};
+        }
+
+        void ClampScroll() {
+            mScrollOffset = ClampOffset(mScrollOffset);
+        }
+
+        bool IsDrawnAbove(uint32_t a, uint32_t b) const {
+            size_t zlevel_a = mChildren[a]->GetZLevel();
+            size_t zlevel_b = mChildren[b]->GetZLevel();
+
+            return zlevel_a != zlevel_b ? zlevel_a > zlevel_b : a > b;
+        }
+
+        // Children not capturing the pointer only see it inside the viewport; the input passes as is when nothing falls outside
+        const Controls& ClipControls(const Controls& controls, sf::FloatRect viewport) {
+            auto is_outside = [&viewport](const InputEvent& event) {
+                bool is_pointer = event.mType == InputType::MouseMoved || event.mType == InputType::MousePressed || event.mType == InputType::MouseReleased || event.mType == InputType::MouseWheel;
+
+                return is_pointer == true && viewport.contains(event.mPosition) == false;
+            };
+
+            bool is_clipped = viewport.contains(controls.mMouse.mPosition) == false;
+
+            for (const InputEvent& event : controls.mEvents) {
+                if (is_outside(event) == true) {
+                    is_clipped = true;
+                }
+            }
+
+            if (is_clipped == false) {
+                return controls;
+            }
+
+            mClipped.mMouse    = controls.mMouse;
+            mClipped.mKeyboard = controls.mKeyboard;
+            mClipped.mEvents.Clear();
+
+            if (viewport.contains(controls.mMouse.mPosition) == false) {
+                mClipped.mMouse.mPosition = {std::numeric_limits<float>::lowest(), std::numeric_limits<float>::lowest()};
+            }
+
+            for (const InputEvent& event : controls.mEvents) {
+                if (is_outside(event) == false) {
+                    mClipped.mEvents.Push(event);
+                }
+            }
+
+            return mClipped;
+        }
+
+        void CollectVisible() {
+            mVisible.clear();
+            mContentGrid.Query(sf::FloatRect(mScrollOffset, mSize), mVisible);
+
+            std::sort(mVisible.begin(), mVisible.end(), [this](uint32_t a, uint32_t b) {
+                return IsDrawnAbove(b, a);
+            });
+        }
+
+    public:
+        ScrollView() = default;
+
+        std::span<const std::shared_ptr<Widget>> GetChildren() const override {
+            return mChildren;
+        }
+
+        uint64_t GetStructureRevision() const override {
+            uint64_t revision = mStructureRevision;
+
+            for (const auto& child : mChildren) {
+                revision += child->GetStructureRevision();
+            }
+
+            return revision;
+        }
+
+        sf::Vector2f GetScrollOffset() const {
+            return mScrollOffset;
+        }
+
+        sf::Vector2f GetContentSize() const {
+            return mContentSize;
+        }
+
+        ScrollView& AddChild(std::shared_ptr<Widget> child) {
+            child->BindChanges(mChildChanges, mSubmits);
+
+            mChildren.push_back(child);
+
+            mIsContentDirty = true;
+            ++mStructureRevision;
+
+            MarkChanged();
+
+            return *this;
+        }
+
+        ScrollView& AddChildren(std::span<const std::shared_ptr<Widget>> children) {
+            for (const auto& child : children) {
+                child->BindChanges(mChildChanges, mSubmits);
+            }
+
+            mChildren.insert(mChildren.end(), children.begin(), children.end());
+
+            mIsContentDirty = true;
+            ++mStructureRevision;
+
+            MarkChanged();
+
+            return *this;
+        }
+
+        // Clamped to the content on the next update or render
+        ScrollView& SetScrollOffset(sf::Vector2f offset) {
+            mScrollOffset = offset;
+
+            MarkChanged();
+
+            return *this;
+        }
+
+        ScrollView& ScrollBy(sf::Vector2f delta) {
+            return SetScrollOffset(mScrollOffset + delta);
+        }
+
+        // Both aim for the offset clamped to the content as it is now
+        ScrollView& ScrollAnimation(sf::Vector2f offset, float duration, std::function<void()> on_complete = nullptr, EasingCurve easing = Easing::OutQuad) {
+            RefreshChildren();
+
+            mTweens.Push<sf::Vector2f>(*this, {}, TweenProperty::ScrollOffset, mScrollOffset, ClampOffset(offset), duration, std::move(on_complete), std::move(easing));
+
+            MarkRequested();
+
+            return *this;
+        }
+
+        // Flicking again mid-scroll keeps the momentum of the running spring
+        ScrollView& ScrollSpring(sf::Vector2f offset, SpringParams params = {}, std::function<void()> on_complete = nullptr) {
+            RefreshChildren();
+
+            mTweens.PushSpring(*this, {}, TweenProperty::ScrollOffset, mScrollOffset, ClampOffset(offset), params, std::move(on_complete));
+
+            MarkRequested();
+
+            return *this;
+        }
+
+        // Pixels per wheel notch; Shift+wheel scrolls horizontally
+        ScrollView& SetScrollStep(float step) {
+            mScrollStep = step;
+
+            return *this;
+        }
+
+        ScrollView& SetHitCellSize(float cell_size) {
+            mContentGrid.SetCellSize(cell_size);
+            mChildRevisions.assign(mChildren.size(), UINT32_MAX);
+
+            mIsContentDirty = true;
+
+            return *this;
+        }
+
+        std::shared_ptr<Widget> CloneImpl() const override {
+            auto cloned = std::make_shared<ScrollView>();
+
+            cloned->mSize         = mSize;
+            cloned->mPosition     = mPosition;
+            cloned->mZLevel       = mZLevel;
+            cloned->mIsVisible    = mIsVisible;
+            cloned->mScrollOffset = mScrollOffset;
+            cloned->mScrollStep   = mScrollStep;
+
+            for (const auto& child : mChildren) {
+                cloned->AddChild(child->CloneImpl());
+            }
+
+            CloneDrawingsTo(cloned.get());
+
+            return cloned;
+        }
+
+        // Children queue their own tweens on the panel's submit list
+        void BindChanges(const std::shared_ptr<ChangeCounter>& changes, const std::shared_ptr<SubmitList>& submits) override {
+            Widget::BindChanges(changes, submits);
+
+            mChildChanges->SetParent(changes);
+
+            for (const auto& child : mChildren) {
+                child->BindChanges(mChildChanges, submits);
+            }
+        }
+
+        // Requesting an animation bumps the change counter, so the children only need a look after a change
+        void SubmitAnimations(AnimationScheduler& scheduler, const std::shared_ptr<Widget>& self) override {
+            Widget::SubmitAnimations(scheduler, self);
+
+            if (mSubmitsSeen == mChildChanges->Get()) {
+                return;
+            }
+
+            for (const auto& child : mChildren) {
+                child->SubmitAnimations(scheduler, child);
+            }
+
+            mSubmitsSeen = mChildChanges->Get();
+        }
+
+        using Widget::ApplyTween;
+
+        bool ApplyTween(TweenProperty property, sf::Vector2f value) override {
+            if (property != TweenProperty::ScrollOffset) {
+                return Widget::ApplyTween(property, value);
+            }
+
+            mScrollOffset = value;
+
+            MarkChanged();
+
+            return true;
+        }
+
+        // Inside the viewport, the topmost child taking focus there wins over the view itself
+        std::shared_ptr<Widget> FindFocusAt(sf::Vector2f position) override {
+            if (sf::FloatRect(mPosition, mSize).contains(position) == false) {
+                return Widget::FindFocusAt(position);
+            }
+
+            RefreshChildren();
+
+            sf::Vector2f pos_content = position - mPosition + ClampOffset(mScrollOffset);
+
+            mFocusHits.clear();
+            mContentGrid.Query(pos_content, mFocusHits);
+
+            std::sort(mFocusHits.begin(), mFocusHits.end(), [this](uint32_t a, uint32_t b) {
+                return IsDrawnAbove(a, b);
+            });
+
+            for (uint32_t index : mFocusHits) {
+                if (mChildren[index]->GetVisibility() == false) {
+                    continue;
+                }
+
+                if (auto hit = mChildren[index]->FindFocusAt(pos_content); hit != nullptr) {
+                    return hit;
+                }
+            }
+
+            return Widget::FindFocusAt(position);
+        }
+
+        bool HasCapture() const override {
+            return mCaptured.empty() == false;
+        }
+
+        // The children's deadlines as of the last update, plus the container's own sprites
+        std::optional<std::chrono::steady_clock::time_point> GetNextDeadline() const override {
+            return Anim::GetEarlier(mNextDeadline, Widget::GetNextDeadline());
+        }
+
+        void UpdateImpl(const Controls& controls, sf::Vector2f pos_panel) override {
+            if (mIsVisible == false) {
+                return;
+            }
+
+            RefreshChildren();
+
+            sf::Vector2f  pos_global  = pos_panel + mPosition;
+            sf::FloatRect viewport    = sf::FloatRect(pos_global, mSize);
+            sf::Vector2f  offset_prev = mScrollOffset;
+
+            for (const InputEvent& event : controls.mEvents) {
+                if (event.mType != InputType::MouseWheel || viewport.contains(event.mPosition) == false) {
+                    continue;
+                }
+
+                if (event.mIsSPressed == true) {
+                    mScrollOffset.x -= event.mWheelDelta * mScrollStep;
+                }
+                else {
+                    mScrollOffset.y -= event.mWheelDelta * mScrollStep;
+                }
+
+                ClampScroll();
+            }
+
+            ClampScroll();
+
+            if (mScrollOffset != offset_prev) {
+                MarkChanged();
+            }
+
+            CollectVisible();
+
+            // A child dragged out of view keeps receiving input until it lets go
+            mDispatch.assign(mVisible.begin(), mVisible.end());
+
+            for (uint32_t index : mCaptured) {
+                if (std::find(mVisible.begin(), mVisible.end(), index) == mVisible.end()) {
+                    mDispatch.push_back(index);
+                }
+            }
+
+            mCaptured.clear();
+            mNextDeadline.reset();
+
+            sf::Vector2f    pos_content = pos_global - mScrollOffset;
+            const Controls& clipped     = ClipControls(controls, viewport);
+
+            for (uint32_t index : mDispatch) {
+                Widget& child = *mChildren[index];
+
+                child.UpdateImpl(child.HasCapture() == true ? controls : clipped, pos_content);
+
+                if (child.HasCapture() == true) {
+                    mCaptured.push_back(index);
+                }
+
+                mNextDeadline = Anim::GetEarlier(mNextDeadline, child.GetNextDeadline());
+            }
+        }
+
+        void RenderImpl(sf::RenderWindow& window, sf::Vector2f pos_panel) override {
+            if (mIsVisible == false) {
+                return;
+            }
+
+            RefreshChildren();
+            ClampScroll();
+            CollectVisible();
+
+            sf::Vector2f pos_global = pos_panel + mPosition;
+
+            RenderAllDrawings(window, pos_global);
+
+            if (mVisible.empty() == true) {
+                return;
+            }
+
+            // The view maps the visible slice of content space onto the widget's pixels, clipping everything else
+            sf::Vector2f window_size = sf::Vector2f(window.getSize());
+            sf::Vector2f pixel_min   = sf::Vector2f(window.mapCoordsToPixel(pos_global));
+            sf::Vector2f pixel_max   = sf::Vector2f(window.mapCoordsToPixel(pos_global + mSize));
+            sf::View     view_prev   = window.getView();
+            sf::View     view_clip   = sf::View(sf::FloatRect(mScrollOffset, mSize));
+
+            view_clip.setViewport(sf::FloatRect({pixel_min.x / window_size.x, pixel_min.y / window_size.y}, {(pixel_max.x - pixel_min.x) / window_size.x, (pixel_max.y - pixel_min.y) / window_size.y}));
+            window.setView(view_clip);
+
+            // Children batch into the panel's quads like any other widget, flushed before the view goes away
+            QuadBatch* batch = QuadBatch::GetCurrent();
+
+            for (uint32_t index : mVisible) {
+                if (batch != nullptr) {
+                    batch->SetZLevel(window, mChildren[index]->GetZLevel());
+
+                    if (mChildren[index]->IsQuadBatchable() == false) {
+                        batch->Flush(window);
+                    }
+                }
+
+                mChildren[index]->RenderImpl(window, {0.0f, 0.0f});
+            }
+
+            FlushQuads(window);
+
+            window.setView(view_prev);
+        }
+    };
+} // namespace Orbis
\ No newline at end of file
@@ -33,6 +33,20 @@ namespace Orbis {
         bool      mShowFill  = true;
         sf::Color mFillColor = sf::Color(100, 150, 255, 255);
 
+        // Retained between frames so a redraw reuses their vertex storage
+        sf::RectangleShape             mTrackShape;
+        sf::RectangleShape             mFillShape;
+        sf::RectangleShape             mHandleShape;
+        std::optional<sf::ConvexShape> mHandleRoundedShape;
+        sf::Vector2f                   mHandleRoundedSize   = {0, 0};
+        float                          mHandleRoundedRadius = 0.0f;
+
+        static void ResizeShape(sf::RectangleShape& shape, sf::Vector2f size) {
+            if (shape.getSize() != size) {
+                shape.setSize(size);
+            }
+        }
+
         sf::Vector2f GetHandlePosition() const {
             float normalized = 0.0f;
 
@@ -92,10 +106,11 @@ namespace Orbis {
         }
 
         void RenderComponents(sf::RenderWindow& window, sf::Vector2f pos_widget) {
-            sf::RectangleShape track(mTrackSize);
-            track.setPosition(pos_widget + mTrackOffset);
-            track.setFillColor(mTrackColor);
-            window.draw(track);
+            ResizeShape(mTrackShape, mTrackSize);
+
+            mTrackShape.setPosition(pos_widget + mTrackOffset);
+            mTrackShape.setFillColor(mTrackColor);
+            window.draw(mTrackShape);
 
             if (mShowFill == true) {
                 sf::Vector2f fill_size = mTrackSize;
@@ -113,16 +128,17 @@ namespace Orbis {
                     fill_size.y *= normalized;
                 }
 
-                sf::RectangleShape fill(fill_size);
-                sf::Vector2f       fill_offset = mTrackOffset;
+                sf::Vector2f fill_offset = mTrackOffset;
 
                 if (mIsHorizontal == false) {
                     fill_offset.y += mTrackSize.y - fill_size.y;
                 }
 
-                fill.setPosition(pos_widget + fill_offset);
-                fill.setFillColor(mFillColor);
-                window.draw(fill);
+                ResizeShape(mFillShape, fill_size);
+
+                mFillShape.setPosition(pos_widget + fill_offset);
+                mFillShape.setFillColor(mFillColor);
+                window.draw(mFillShape);
             }
 
             sf::Vector2f handle_pos = pos_widget + mTrackOffset + GetHandlePosition();
@@ -137,18 +153,41 @@ namespace Orbis {
             }
 
             if (mHandleRounded == true) {
-                sf::ConvexShape handle = sf::RectRounded(mHandleSize, mHandleRadius);
+                if (mHandleRoundedShape.has_value() == false || mHandleRoundedSize != mHandleSize || mHandleRoundedRadius != mHandleRadius) {
+                    if (mHandleRoundedShape.has_value() == false) {
+                        mHandleRoundedShape.emplace();
+                    }
+
+                    sf::RectRounded(mHandleRoundedShape.value(), mHandleSize, mHandleRadius);
+
+                    mHandleRoundedSize   = mHandleSize;
+                    mHandleRoundedRadius = mHandleRadius;
+                }
+
+                sf::ConvexShape& handle = mHandleRoundedShape.value();
 
                 handle.setPosition(handle_pos);
                 handle.setFillColor(GetHandleColor());
                 window.draw(handle);
             }
             else {
-                sf::RectangleShape handle(mHandleSize);
+                ResizeShape(mHandleShape, mHandleSize);
 
-                handle.setPosition(handle_pos);
-                handle.setFillColor(GetHandleColor());
-                window.draw(handle);
+                mHandleShape.setPosition(handle_pos);
+                mHandleShape.setFillColor(GetHandleColor());
+                window.draw(mHandleShape);
+            }
+        }
+
+        void ApplyValue(float new_value) {
+            if (new_value == mValue) {
+                return;
+            }
+
+            mValue = new_value;
+
+            if (mOnValueChanged) {
+                mOnValueChanged(mValue);
             }
         }
 
@@ -189,15 +228,42 @@ namespace Orbis {
             mValueMax = max;
             mValue    = std::max(mValueMin, std::min(mValueMax, mValue));
 
+            MarkChanged();
+
             return *this;
         }
 
         Slider& SetValue(float value) {
             mValue = std::max(mValueMin, std::min(mValueMax, value));
 
+            MarkChanged();
+
             return *this;
         }
 
+        // Reports every intermediate value through the value-changed callback
+        Slider& ValueAnimation(float target, float duration, std::function<void()> on_complete = nullptr, EasingCurve easing = Easing::OutQuad) {
+            mTweens.Push<float>(*this, {}, TweenProperty::Value, mValue, target, duration, std::move(on_complete), std::move(easing));
+
+            MarkRequested();
+
+            return *this;
+        }
+
+        using Widget::ApplyTween;
+
+        bool ApplyTween(TweenProperty property, float value) override {
+            if (property != TweenProperty::Value) {
+                return Widget::ApplyTween(property, value);
+            }
+
+            ApplyValue(std::max(mValueMin, std::min(mValueMax, value)));
+
+            MarkChanged();
+
+            return true;
+        }
+
         Slider& SetStepSize(float step) {
             mStepSize = step;
 
@@ -207,6 +273,8 @@ namespace Orbis {
         Slider& SetOrientation(bool horizontal) {
             mIsHorizontal = horizontal;
 
+            MarkChanged();
+
             return *this;
         }
 
@@ -219,48 +287,64 @@ namespace Orbis {
         Slider& SetTrackSize(sf::Vector2f size) {
             mTrackSize = size;
 
+            InvalidateBounds();
+
             return *this;
         }
 
         Slider& SetTrackOffset(sf::Vector2f offset) {
             mTrackOffset = offset;
 
+            InvalidateBounds();
+
             return *this;
         }
 
         Slider& SetTrackColor(sf::Color color) {
             mTrackColor = color;
 
+            MarkChanged();
+
             return *this;
         }
 
         Slider& SetShowFill(bool show) {
             mShowFill = show;
 
+            MarkChanged();
+
             return *this;
         }
 
         Slider& SetFillColor(sf::Color color) {
             mFillColor = color;
 
+            MarkChanged();
+
             return *this;
         }
 
         Slider& SetHandleSize(sf::Vector2f size) {
             mHandleSize = size;
 
+            InvalidateBounds();
+
             return *this;
         }
 
         Slider& SetHandleRadius(float radius) {
             mHandleRadius = radius;
 
+            MarkChanged();
+
             return *this;
         }
 
         Slider& SetHandleRounded(bool rounded) {
             mHandleRounded = rounded;
 
+            MarkChanged();
+
             return *this;
         }
 
@@ -276,6 +360,9 @@ namespace Orbis {
                     mHandleColorDragging = color;
                     break;
             }
+
+            MarkChanged();
+
             return *this;
         }
 
@@ -312,62 +399,85 @@ namespace Orbis {
             return cloned;
         }
 
+        sf::FloatRect GetHitBounds() const override {
+            sf::Vector2f track_pos = mPosition + mTrackOffset;
+
+            return sf::FloatRect(track_pos - mHandleSize, mTrackSize + mHandleSize * 2.0f);
+        }
+
+        bool HasCapture() const override {
+            return mIsDragging;
+        }
+
         void UpdateImpl(const Controls& controls, sf::Vector2f pos_panel) override {
             if (mIsVisible == false) {
                 return;
             }
 
-            sf::Vector2f  pos_global    = pos_panel + mPosition;
-            sf::FloatRect handle_bounds = GetHandleBounds(pos_global);
-            sf::FloatRect track_bounds(pos_global + mTrackOffset, mTrackSize);
+            sf::Vector2f pos_global = pos_panel + mPosition;
+            SliderState  state_prev = mState;
+            float        value_prev = mValue;
+
+            for (const InputEvent& event : controls.mEvents) {
+                switch (event.mType) {
+                    case InputType::MousePressed: {
+                        if (event.mButton != sf::Mouse::Button::Left) {
+                            break;
+                        }
 
-            bool is_handle_hovered = handle_bounds.contains(controls.mMouse.mPosition);
-            bool is_track_clicked  = track_bounds.contains(controls.mMouse.mPosition);
+                        sf::FloatRect handle_bounds = GetHandleBounds(pos_global);
+                        sf::FloatRect track_bounds(pos_global + mTrackOffset, mTrackSize);
 
-            if (mIsDragging == true) {
-                if (controls.mMouse.mIsLPressed == true) {
-                    float new_value = CalculateValueFromPos(controls.mMouse.mPosition, pos_global);
+                        if (handle_bounds.contains(event.mPosition) == true) {
+                            mIsDragging = true;
+                            mDragOffset = event.mPosition - (pos_global + mTrackOffset + GetHandlePosition());
+                        }
+                        else if (track_bounds.contains(event.mPosition) == true) {
+                            ApplyValue(CalculateValueFromPos(event.mPosition, pos_global));
 
-                    if (new_value != mValue) {
-                        mValue = new_value;
+                            mIsDragging = true;
+                        }
 
-                        if (mOnValueChanged) {
-                            mOnValueChanged(mValue);
+                        // Grabbing the slider takes over from a running value animation
+                        if (mIsDragging == true) {
+                            BeginTween(TweenProperty::Value);
                         }
-                    }
 
-                    mState = SliderState::Dragging;
-                }
-                else {
-                    mIsDragging = false;
-                    mState      = is_handle_hovered ? SliderState::Hover : SliderState::Normal;
-                }
-            }
-            else {
-                if (controls.mMouse.mIsLPressed == true) {
-                    if (is_handle_hovered == true) {
-                        mIsDragging = true;
-                        mDragOffset = controls.mMouse.mPosition - (pos_global + mTrackOffset + GetHandlePosition());
-                        mState      = SliderState::Dragging;
+                        break;
                     }
-                    else if (is_track_clicked == true) {
-                        float new_value = CalculateValueFromPos(controls.mMouse.mPosition, pos_global);
+                    case InputType::MouseMoved: {
+                        if (mIsDragging == true) {
+                            ApplyValue(CalculateValueFromPos(event.mPosition, pos_global));
+                        }
 
-                        if (new_value != mValue) {
-                            mValue = new_value;
+                        break;
+                    }
+                    case InputType::MouseReleased: {
+                        if (event.mButton == sf::Mouse::Button::Left && mIsDragging == true) {
+                            ApplyValue(CalculateValueFromPos(event.mPosition, pos_global));
 
-                            if (mOnValueChanged) {
-                                mOnValueChanged(mValue);
-                            }
+                            mIsDragging = false;
                         }
 
-                        mIsDragging = true;
-                        mState      = SliderState::Dragging;
+                        break;
+                    }
+                    default: {
+                        break;
                     }
                 }
-                else {
-                    mState = is_handle_hovered ? SliderState::Hover : SliderState::Normal;
-                }
+            }
+
+            bool is_handle_hovered = GetHandleBounds(pos_global).contains(controls.mMouse.mPosition);
+
+            if (mIsDragging == true) {
+                mState = SliderState::Dragging;
+            }
+            else {
+                mState = is_handle_hovered ? SliderState::Hover : SliderState::Normal;
+            }
+
+            if (mState != state_prev || mValue != value_prev) {
+                MarkChanged();
             }
         }
 
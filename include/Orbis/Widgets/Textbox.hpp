@@ -4,6 +4,8 @@
 #include <limits>
 
 #include "Orbis/SFML/Shapes.hpp"
+#include "Orbis/System/GapBuffer.hpp"
+#include "Orbis/System/GlyphRun.hpp"
 #include "Orbis/Widgets/Widget.hpp"
 
 namespace Orbis {
@@ -13,10 +15,13 @@ namespace Orbis {
         std::function<void(const sf::String&)> mOnRawTextChanged;
         std::function<void()>                  mOnEnterPressed;
 
-        sf::String  mText        = "";
+        GapBuffer   mText; // edited in place, GetTextContent() joins it
         sf::String  mPlaceholder = "";
         std::string mIDEditable  = "";
 
+        mutable sf::String mTextContent;
+        mutable bool       mIsContentStale = false;
+
         size_t mCursorPos      = 0;
         size_t mSelectionStart = 0;
         size_t mSelectionEnd   = 0;
@@ -25,124 +30,149 @@ namespace Orbis {
         // CursorStyle  mCursorStyle = CursorStyle::Line;
         bool mIsWideText = false;
 
-        bool                                  mIsCursorVisible = false;
-        std::chrono::steady_clock::time_point mCursorLastBlink;
+        std::chrono::steady_clock::time_point mCursorLastBlink; // blink phase origin, reset by typing and clicks
         float                                 mCursorBlinkInterval = 0.5f;
 
         float mScrollOffset = 0.0f;
         float mPadding      = 0.0f;
 
-        void InvalidateCache() {
-            if (mIDEditable.empty() == true) {
-                return;
+        // Retained render objects, only touched when their font, size or string actually changes
+        std::optional<sf::Text> mPlaceholderText;
+        sf::RectangleShape      mHighlightShape;
+        sf::RectangleShape      mCursorShape;
+
+        // Layout of the editable text, spliced by every edit so only new characters are measured; the cursor x of
+        // every position comes from it, and a font or size change lays it out again in full
+        GlyphRun mRun;
+        bool     mIsRunStale   = true;
+        uint64_t mTextRevision = 0; // bumped on every edit of mText
+
+        // Everything the retained text, highlight and cursor were laid out from. Compared every render, so an
+        // unchanged box draws like a static label; the cursor blink only decides whether the cursor quad is drawn.
+        struct RenderLayout {
+            uint64_t        mTextRevision   = UINT64_MAX;
+            const sf::Font* mFont           = nullptr;
+            size_t          mFontSize       = 0;
+            sf::Color       mFillColor      = sf::Color::Transparent;
+            TextAlign       mAlign          = TextAlign::LeftTop;
+            sf::Vector2f    mPosition       = {0, 0}; // of the text in the window, scroll and padding applied
+            size_t          mCursorPos      = 0;
+            size_t          mSelectionStart = 0;
+            size_t          mSelectionEnd   = 0;
+            bool            mIsFocused      = false;
+
+            bool operator==(const RenderLayout&) const = default;
+        };
+
+        RenderLayout mLayout;
+        sf::Vector2f mTextOrigin         = {0, 0};
+        bool         mIsPlaceholderShown = false;
+        bool         mIsHighlightShown   = false;
+
+        static sf::Text& SyncText(std::optional<sf::Text>& text, const sf::Font& font, const sf::String& string, size_t font_size) {
+            if (text.has_value() == false) {
+                return text.emplace(font, string, font_size);
             }
 
-            if (mIsWideText == false) {
-                auto iter = mDrawingsText.find(mIDEditable);
-
-                if (iter != mDrawingsText.end()) {
-                    iter->second->mCachedText.reset();
-                }
+            if (&text->getFont() != &font) {
+                text->setFont(font);
             }
-            else {
-                auto iter = mDrawingsWText.find(mIDEditable);
 
-                if (iter != mDrawingsWText.end()) {
-                    iter->second->mCachedText.reset();
-                }
+            if (text->getCharacterSize() != font_size) {
+                text->setCharacterSize(font_size);
             }
-        }
 
-        void UpdateDrawingText(const sf::String& new_text) {
-            if (mIDEditable.empty() == true) {
-                return;
+            if (text->getString() != string) {
+                text->setString(string);
             }
 
+            return text.value();
+        }
+
+        void GetEditableFont(std::shared_ptr<sf::Font>& font, size_t& font_size) const {
             if (mIsWideText == false) {
-                auto iter = mDrawingsText.find(mIDEditable);
+                const DrawingsText& text_drawing = GetText(mIDEditable);
 
-                if (iter != mDrawingsText.end()) {
-                    iter->second->mText = new_text.toAnsiString();
-                    iter->second->mCachedText.reset();
-                }
+                font      = text_drawing.mFont;
+                font_size = text_drawing.mFontSize;
             }
             else {
-                auto iter = mDrawingsWText.find(mIDEditable);
+                const DrawingsWText& text_drawing = GetWText(mIDEditable);
 
-                if (iter != mDrawingsWText.end()) {
-                    iter->second->mWText = new_text.toWideString();
-                    iter->second->mCachedText.reset();
-                }
+                font      = text_drawing.mFont;
+                font_size = text_drawing.mFontSize;
             }
         }
 
-        float GetCursorPosX() const {
-            if (mIDEditable.empty() == true) {
-                return 0.0f;
-            }
+        GlyphRun& GetRun() {
+            std::shared_ptr<sf::Font> font;
+            size_t                    font_size;
 
-            if (mText.isEmpty() == true || mCursorPos == 0) {
-                return 0.0f;
-            }
+            GetEditableFont(font, font_size);
 
-            if (mIsWideText == false) {
-                const DrawingsText& text_drawing = GetText(mIDEditable);
-                sf::Text            temp         = sf::Text(*text_drawing.mFont, mText.substring(0, mCursorPos), text_drawing.mFontSize);
+            if (mIsRunStale == true || mRun.IsLaidOut(font, font_size) == false || mRun.GetSize() != mText.GetSize()) {
+                mRun.Assign(mText, mText.GetSize(), font, font_size);
 
-                return temp.getLocalBounds().size.x;
+                mIsRunStale = false;
             }
-            else {
-                const DrawingsWText& text_drawing = GetWText(mIDEditable);
-                sf::Text             temp         = sf::Text(*text_drawing.mFont, mText.substring(0, mCursorPos), text_drawing.mFontSize);
 
-                return temp.getLocalBounds().size.x;
-            }
+            return mRun;
         }
 
-        size_t GetCursorPosFromMouseX(float mouse_x, sf::Vector2f widget_pos) const {
-            if (mIDEditable.empty() == true) {
-                return 0;
+        // Every keystroke edit ends here, with mText already changed: `erased` characters at start became `inserted` ones
+        void OnTextEdited(size_t start, size_t erased, size_t inserted) {
+            ++mTextRevision;
+
+            mIsContentStale = true;
+
+            if (mIsRunStale == false) {
+                mRun.Splice(mText, mText.GetSize(), start, erased, inserted);
             }
 
-            float adjusted_x = mouse_x - widget_pos.x - mPadding + mScrollOffset;
+            MarkChanged();
 
-            if (adjusted_x <= 0.0f) {
-                return 0;
+            if (mOnTextChanged) {
+                mOnTextChanged(GetTextContent());
             }
+        }
 
-            std::shared_ptr<sf::Font> font;
-            size_t                    font_size;
+        // Whole-text replacements, laid out again on the next measure
+        void ReplaceText(const sf::String& text) {
+            mText.Assign(text.toUtf32());
 
-            if (mIsWideText == false) {
-                const DrawingsText& text_drawing = GetText(mIDEditable);
-                font                             = text_drawing.mFont;
-                font_size                        = text_drawing.mFontSize;
+            ++mTextRevision;
+
+            mIsContentStale = true;
+            mIsRunStale     = true;
+
+            MarkChanged();
+        }
+
+        float GetCursorPosX() {
+            if (mIDEditable.empty() == true) {
+                return 0.0f;
             }
-            else {
-                const DrawingsWText& text_drawing = GetWText(mIDEditable);
-                font                              = text_drawing.mFont;
-                font_size                         = text_drawing.mFontSize;
+
+            if (mText.IsEmpty() == true || mCursorPos == 0) {
+                return 0.0f;
             }
 
-            for (size_t i = 0; i <= mText.getSize(); ++i) {
-                sf::Text temp = sf::Text(*font, mText.substring(0, i), font_size);
-                float    x    = temp.getLocalBounds().size.x;
+            return GetRun().GetCursorX(mCursorPos);
+        }
 
-                if (adjusted_x <= x) {
-                    if (0 < i) {
-                        sf::Text prev   = sf::Text(*font, mText.substring(0, i - 1), font_size);
-                        float    prev_x = prev.getLocalBounds().size.x;
+        // Nearest cursor position, by binary search over the laid out run
+        size_t GetCursorPosFromMouseX(float mouse_x, sf::Vector2f widget_pos) {
+            if (mIDEditable.empty() == true) {
+                return 0;
+            }
 
-                        if ((adjusted_x - prev_x) < (x - adjusted_x)) {
-                            return i - 1;
-                        }
-                    }
+            float adjusted_x = mouse_x - widget_pos.x - mPadding + mScrollOffset;
 
-                    return i;
-                }
+            if (adjusted_x <= 0.0f) {
+                return 0;
             }
 
-            return mText.getSize();
+            return GetRun().GetIndexAt(adjusted_x);
         }
 
         void MoveCursor(int delta, bool selecting) {
@@ -154,7 +184,7 @@ namespace Orbis {
                 }
             }
             else if (0 < delta) {
-                if (new_pos < mText.getSize()) {
+                if (new_pos < mText.GetSize()) {
                     new_pos++;
                 }
             }
@@ -178,20 +208,15 @@ namespace Orbis {
                 return;
             }
 
-            size_t     start  = std::min(mSelectionStart, mSelectionEnd);
-            size_t     end    = std::max(mSelectionStart, mSelectionEnd);
-            sf::String before = mText.substring(0, start);
-            sf::String after  = mText.substring(end);
+            size_t start = std::min(mSelectionStart, mSelectionEnd);
+            size_t end   = std::min(std::max(mSelectionStart, mSelectionEnd), mText.GetSize());
+
+            mText.Erase(start, end - start);
 
-            mText           = before + after;
             mCursorPos      = start;
             mSelectionStart = mSelectionEnd = 0;
 
-            UpdateDrawingText(mText);
-
-            if (mOnTextChanged) {
-                mOnTextChanged(mText);
-            }
+            OnTextEdited(start, end - start, 0);
         }
 
         void InsertText(const sf::String& text) {
@@ -199,18 +224,13 @@ namespace Orbis {
                 DeleteSelection();
             }
 
-            sf::String before = mText.substring(0, mCursorPos);
-            sf::String after  = mText.substring(mCursorPos);
+            size_t start = mCursorPos;
 
-            mText = before + text + after;
+            mText.Insert(start, text.toUtf32());
 
             mCursorPos += text.getSize();
 
-            UpdateDrawingText(mText);
-
-            if (mOnTextChanged) {
-                mOnTextChanged(mText);
-            }
+            OnTextEdited(start, 0, text.getSize());
         }
 
         void DeleteAtCursor(bool forward = false) {
@@ -220,37 +240,122 @@ namespace Orbis {
             }
 
             if (forward == true) {
-                if (mCursorPos < mText.getSize()) {
-                    sf::String before = mText.substring(0, mCursorPos);
-                    sf::String after  = mText.substring(mCursorPos + 1);
-
-                    mText = before + after;
-
-                    UpdateDrawingText(mText);
+                if (mCursorPos < mText.GetSize()) {
+                    mText.Erase(mCursorPos, 1);
 
-                    if (mOnTextChanged) {
-                        mOnTextChanged(mText);
-                    }
+                    OnTextEdited(mCursorPos, 1, 0);
                 }
             }
             else {
                 if (0 < mCursorPos) {
-                    sf::String before = mText.substring(0, mCursorPos - 1);
-                    sf::String after  = mText.substring(mCursorPos);
+                    mCursorPos--;
 
-                    mText = before + after;
+                    mText.Erase(mCursorPos, 1);
 
-                    mCursorPos--;
+                    OnTextEdited(mCursorPos, 1, 0);
+                }
+            }
+        }
+
+        void HandleKeyPressed(const InputEvent& event) {
+            switch (event.mKey) {
+                case sf::Keyboard::Key::Left: {
+                    MoveCursor(-1, event.mIsSPressed);
+                    UpdateScrollOffset();
+
+                    break;
+                }
+                case sf::Keyboard::Key::Right: {
+                    MoveCursor(1, event.mIsSPressed);
+                    UpdateScrollOffset();
+
+                    break;
+                }
+                case sf::Keyboard::Key::Home: {
+                    if (event.mIsSPressed == true) {
+                        if (mSelectionStart == mSelectionEnd) {
+                            mSelectionStart = mCursorPos;
+                        }
+
+                        mSelectionEnd = 0;
+                    }
+                    else {
+                        mSelectionStart = mSelectionEnd = 0;
+                    }
+
+                    mCursorPos = 0;
 
-                    UpdateDrawingText(mText);
+                    UpdateScrollOffset();
+
+                    break;
+                }
+                case sf::Keyboard::Key::End: {
+                    if (event.mIsSPressed == true) {
+                        if (mSelectionStart == mSelectionEnd) {
+                            mSelectionStart = mCursorPos;
+                        }
+
+                        mSelectionEnd = mText.GetSize();
+                    }
+                    else {
+                        mSelectionStart = mSelectionEnd = 0;
+                    }
+
+                    mCursorPos = mText.GetSize();
+
+                    UpdateScrollOffset();
+
+                    break;
+                }
+                case sf::Keyboard::Key::Backspace: {
+                    DeleteAtCursor(false);
+                    UpdateScrollOffset();
+
+                    break;
+                }
+                case sf::Keyboard::Key::Delete: {
+                    DeleteAtCursor(true);
+                    UpdateScrollOffset();
+
+                    break;
+                }
+                case sf::Keyboard::Key::Enter: {
+                    if (mOnEnterPressed) {
+                        mOnEnterPressed();
+                    }
 
-                    if (mOnTextChanged) {
-                        mOnTextChanged(mText);
+                    break;
+                }
+                case sf::Keyboard::Key::A: {
+                    if (event.mIsCPressed == true) {
+                        mSelectionStart = 0;
+                        mSelectionEnd   = mText.GetSize();
                     }
+
+                    break;
+                }
+                // TODO: Ctrl+C, Ctrl+V, Ctrl+X
+                default: {
+                    break;
                 }
             }
         }
 
+        std::chrono::steady_clock::duration GetBlinkInterval() const {
+            return std::chrono::duration_cast<std::chrono::steady_clock::duration>(std::chrono::duration<float>(mCursorBlinkInterval));
+        }
+
+        // Derived from the clock rather than toggled per frame, so an unattended focused box costs nothing until it redraws
+        bool IsCursorVisible() const {
+            auto interval = GetBlinkInterval();
+
+            if (interval.count() <= 0) {
+                return true;
+            }
+
+            return ((Clock::GetNow() - mCursorLastBlink) / interval) % 2 == 0;
+        }
+
         void UpdateScrollOffset() {
             if (mIDEditable.empty() == true) {
                 return;
@@ -272,15 +377,80 @@ namespace Orbis {
             }
         }
 
+        static sf::Vector2f GetAlignOffset(TextAlign align, sf::FloatRect bounds, size_t font_size) {
+            sf::Vector2f offset = {0, 0};
+
+            if (align == TextAlign::CenterTop || align == TextAlign::Center || align == TextAlign::CenterBottom) {
+                offset.x = -(bounds.size.x) / 2.0f;
+            }
+            else if (align == TextAlign::RightTop || align == TextAlign::RightCenter || align == TextAlign::RightBottom) {
+                offset.x = -(bounds.size.x);
+            }
+
+            if (align == TextAlign::LeftCenter || align == TextAlign::Center || align == TextAlign::RightCenter) {
+                offset.y = -(static_cast<float>(font_size)) / 2.0f;
+            }
+            else if (align == TextAlign::LeftBottom || align == TextAlign::CenterBottom || align == TextAlign::RightBottom) {
+                offset.y = -(static_cast<float>(font_size));
+            }
+
+            return offset;
+        }
+
+        // Lays out the placeholder, or positions the text run with its highlight and cursor
+        void RebuildLayout(const RenderLayout& layout, const sf::Font& font) {
+            size_t font_size = layout.mFontSize;
+
+            mIsPlaceholderShown = mText.IsEmpty() == true && layout.mIsFocused == false && mPlaceholder.isEmpty() == false;
+            mIsHighlightShown   = false;
+
+            if (mIsPlaceholderShown == true) {
+                sf::Text& placeholder_text = SyncText(mPlaceholderText, font, mPlaceholder, font_size);
+
+                placeholder_text.setPosition(layout.mPosition + GetAlignOffset(layout.mAlign, placeholder_text.getLocalBounds(), font_size));
+                placeholder_text.setFillColor(sf::Color(150, 150, 150, 255));
+            }
+            else {
+                GlyphRun& run = GetRun();
+
+                mTextOrigin = layout.mPosition + GetAlignOffset(layout.mAlign, sf::FloatRect({0, 0}, {run.GetWidth(), 0}), font_size);
+
+                run.SetColor(layout.mFillColor);
+
+                if (mSelectionStart != mSelectionEnd && layout.mIsFocused == true) {
+                    float selection_start_x = run.GetCursorX(std::min(mSelectionStart, mSelectionEnd));
+                    float selection_end_x   = run.GetCursorX(std::max(mSelectionStart, mSelectionEnd));
+
+                    mHighlightShape.setSize({selection_end_x - selection_start_x, static_cast<float>(font_size)});
+                    mHighlightShape.setPosition({mTextOrigin.x + selection_start_x, mTextOrigin.y});
+                    mHighlightShape.setFillColor(sf::Color(100, 150, 255, 128));
+
+                    mIsHighlightShown = true;
+                }
+
+                mCursorShape.setSize({2.0f, static_cast<float>(font_size)});
+                mCursorShape.setPosition({mTextOrigin.x + run.GetCursorX(mCursorPos), mTextOrigin.y});
+                mCursorShape.setFillColor(layout.mFillColor);
+            }
+
+            mLayout = layout;
+        }
+
     public:
         TextboxSingle() = default;
 
         bool IsContentEmpty() const {
-            return mText.isEmpty();
+            return mText.IsEmpty();
         }
 
+        // Joined from the gap buffer when asked for, so typing only pays for a whole string when someone reads it
         const sf::String& GetTextContent() const {
-            return mText;
+            if (mIsContentStale == true) {
+                mTextContent    = sf::String(mText.ToString());
+                mIsContentStale = false;
+            }
+
+            return mTextContent;
         }
 
         DrawingsText& GetText(const std::string& id) const {
@@ -317,13 +487,21 @@ namespace Orbis {
 
         TextboxSingle& SetPlaceholder(const sf::String& placeholder) {
             mPlaceholder = placeholder;
+            mLayout      = RenderLayout();
+
+            MarkChanged();
 
             return *this;
         }
 
+        // As in TextboxMulti, the drawing only supplies font, size, color and position; its own string is never drawn
+        // or updated, so an edit never copies the whole text
         TextboxSingle& SetEditableText(const std::string& text_id) {
             mIDEditable = text_id;
             mIsWideText = false;
+            mLayout     = RenderLayout();
+
+            MarkChanged();
 
             return *this;
         }
@@ -331,6 +509,9 @@ namespace Orbis {
         TextboxSingle& SetEditableWText(const std::string& wtext_id) {
             mIDEditable = wtext_id;
             mIsWideText = true;
+            mLayout     = RenderLayout();
+
+            MarkChanged();
 
             return *this;
         }
@@ -344,19 +525,21 @@ namespace Orbis {
         TextboxSingle& SetPadding(float padding) {
             mPadding = padding;
 
+            MarkChanged();
+
             return *this;
         }
 
         TextboxSingle& SetText(const sf::String& text) {
-            mText           = text;
+            ReplaceText(text);
+
             mCursorPos      = text.getSize();
             mSelectionStart = mSelectionEnd = 0;
 
-            UpdateDrawingText(mText);
             UpdateScrollOffset();
 
             if (mOnTextChanged) {
-                mOnTextChanged(mText);
+                mOnTextChanged(GetTextContent());
             }
 
             return *this;
@@ -386,10 +569,10 @@ namespace Orbis {
                     *value_ptr  = clamped;
 
                     if (clamped != parsed) {
-                        mText      = std::to_string(clamped);
-                        mCursorPos = mText.getSize();
+                        ReplaceText(std::to_string(clamped));
+
+                        mCursorPos = mText.GetSize();
 
-                        UpdateDrawingText(mText);
                         UpdateScrollOffset();
                     }
 
@@ -401,16 +584,15 @@ namespace Orbis {
                 } catch (const std::out_of_range&) {
                     if (text_str[0] == '-') {
                         *value_ptr = min_value;
-                        mText      = std::to_string(min_value);
+                        ReplaceText(std::to_string(min_value));
                     }
                     else {
                         *value_ptr = max_value;
-                        mText      = std::to_string(max_value);
+                        ReplaceText(std::to_string(max_value));
                     }
 
-                    mCursorPos = mText.getSize();
+                    mCursorPos = mText.GetSize();
 
-                    UpdateDrawingText(mText);
                     UpdateScrollOffset();
 
                     if (mOnRawTextChanged) {
@@ -447,8 +629,9 @@ namespace Orbis {
                     *value_ptr = clamped;
 
                     if (std::abs(clamped - parsed) > 0.0001f) {
-                        mText      = std::to_string(clamped);
-                        mCursorPos = mText.getSize();
+                        ReplaceText(std::to_string(clamped));
+
+                        mCursorPos = mText.GetSize();
 
                         UpdateScrollOffset();
                     }
@@ -458,14 +641,14 @@ namespace Orbis {
                 } catch (const std::out_of_range&) {
                     if (text_str[0] == '-') {
                         *value_ptr = min_value;
-                        mText      = std::to_string(min_value);
+                        ReplaceText(std::to_string(min_value));
                     }
                     else {
                         *value_ptr = max_value;
-                        mText      = std::to_string(max_value);
+                        ReplaceText(std::to_string(max_value));
                     }
 
-                    mCursorPos = mText.getSize();
+                    mCursorPos = mText.GetSize();
 
                     UpdateScrollOffset();
                 }
@@ -486,6 +669,7 @@ namespace Orbis {
             cloned->mZLevel         = mZLevel;
             cloned->mIsVisible      = mIsVisible;
             cloned->mText           = mText;
+            cloned->mIsContentStale = true;
             cloned->mPlaceholder    = mPlaceholder;
             cloned->mIDEditable     = mIDEditable;
             cloned->mOnTextChanged  = mOnTextChanged;
@@ -496,121 +680,92 @@ namespace Orbis {
             return cloned;
         }
 
-        void UpdateImpl(const Controls& controls, sf::Vector2f pos_panel) override {
-            if (mIsVisible == false) {
+        bool IsFocusable() const override {
+            return true;
+        }
+
+        void OnFocusChanged(bool is_focused) override {
+            mState          = is_focused ? TextboxState::Focused : TextboxState::Normal;
+            mSelectionStart = mSelectionEnd = 0;
+            mCursorLastBlink                = Clock::GetNow();
+
+            MarkChanged();
+        }
+
+        void HandleKeyEvent(const InputEvent& event) override {
+            if (mIsVisible == false || mState != TextboxState::Focused) {
                 return;
             }
 
-            sf::Vector2f  pos_global = pos_panel + mPosition;
-            sf::FloatRect bounds(pos_global, mSize);
+            size_t cursor_prev          = mCursorPos;
+            size_t selection_start_prev = mSelectionStart;
+            size_t selection_end_prev   = mSelectionEnd;
 
-            bool is_hovered   = bounds.contains(controls.mMouse.mPosition);
-            auto left_pressed = std::find(controls.mMouse.mButtonsPressed.begin(), controls.mMouse.mButtonsPressed.end(), sf::Mouse::Button::Left);
-
-            if (left_pressed != controls.mMouse.mButtonsPressed.end()) {
-                if (is_hovered == true) {
-                    mState          = TextboxState::Focused;
-                    mCursorPos      = GetCursorPosFromMouseX(controls.mMouse.mPosition.x, pos_global);
-                    mSelectionStart = mSelectionEnd = 0;
-                    mIsCursorVisible                = true;
-                    mCursorLastBlink                = std::chrono::steady_clock::now();
-                }
-                else {
-                    mState          = TextboxState::Normal;
-                    mSelectionStart = mSelectionEnd = 0;
-                }
+            if (event.mType == InputType::TextEntered) {
+                InsertText(sf::String(event.mUnicode));
+                UpdateScrollOffset();
+            }
+            else if (event.mType == InputType::KeyPressed) {
+                HandleKeyPressed(event);
             }
             else {
-                if (mState != TextboxState::Focused && is_hovered == true) {
-                    mState = TextboxState::Hover;
-                }
-                else if (mState != TextboxState::Focused) {
-                    mState = TextboxState::Normal;
-                }
+                return;
             }
 
-            if (mState == TextboxState::Focused) {
-                if (controls.mKeyboard.HasText() == true) {
-                    InsertText(controls.mKeyboard.mTextEntered);
-                    UpdateScrollOffset();
-
-                    mIsCursorVisible = true;
-                    mCursorLastBlink = std::chrono::steady_clock::now();
-                }
-
-                if (controls.mKeyboard.IsKeyPressed(sf::Keyboard::Key::Left) == true) {
-                    MoveCursor(-1, controls.mKeyboard.mIsSPressed);
-                    UpdateScrollOffset();
-                }
+            mCursorLastBlink = Clock::GetNow();
 
-                if (controls.mKeyboard.IsKeyPressed(sf::Keyboard::Key::Right) == true) {
-                    MoveCursor(1, controls.mKeyboard.mIsSPressed);
-                    UpdateScrollOffset();
-                }
+            if (mCursorPos != cursor_prev || mSelectionStart != selection_start_prev || mSelectionEnd != selection_end_prev) {
+                MarkChanged();
+            }
+        }
 
-                if (controls.mKeyboard.IsKeyPressed(sf::Keyboard::Key::Home) == true) {
-                    if (controls.mKeyboard.mIsSPressed == true) {
-                        if (mSelectionStart == mSelectionEnd) {
-                            mSelectionStart = mCursorPos;
-                        }
+        std::optional<std::chrono::steady_clock::time_point> GetNextDeadline() const override {
+            auto interval = GetBlinkInterval();
 
-                        mSelectionEnd = 0;
-                    }
-                    else {
-                        mSelectionStart = mSelectionEnd = 0;
-                    }
+            if (mState != TextboxState::Focused || interval.count() <= 0) {
+                return Widget::GetNextDeadline();
+            }
 
-                    mCursorPos = 0;
+            auto phases = (Clock::GetNow() - mCursorLastBlink) / interval;
 
-                    UpdateScrollOffset();
-                }
-                if (controls.mKeyboard.IsKeyPressed(sf::Keyboard::Key::End) == true) {
-                    if (controls.mKeyboard.mIsSPressed == true) {
-                        if (mSelectionStart == mSelectionEnd) {
-                            mSelectionStart = mCursorPos;
-                        }
+            return Anim::GetEarlier(Widget::GetNextDeadline(), mCursorLastBlink + interval * (phases + 1));
+        }
 
-                        mSelectionEnd = mText.getSize();
-                    }
-                    else {
-                        mSelectionStart = mSelectionEnd = 0;
-                    }
+        // Pointer only; focus itself is assigned by the context's FocusManager
+        void UpdateImpl(const Controls& controls, sf::Vector2f pos_panel) override {
+            if (mIsVisible == false) {
+                return;
+            }
 
-                    mCursorPos = mText.getSize();
+            sf::Vector2f  pos_global = pos_panel + mPosition;
+            sf::FloatRect bounds(pos_global, mSize);
 
-                    UpdateScrollOffset();
-                }
+            TextboxState state_prev  = mState;
+            size_t       cursor_prev = mCursorPos;
 
-                if (controls.mKeyboard.IsKeyPressed(sf::Keyboard::Key::Backspace) == true) {
-                    DeleteAtCursor(false);
-                    UpdateScrollOffset();
+            for (const InputEvent& event : controls.mEvents) {
+                if (event.mType != InputType::MousePressed || event.mButton != sf::Mouse::Button::Left) {
+                    continue;
                 }
 
-                if (controls.mKeyboard.IsKeyPressed(sf::Keyboard::Key::Delete) == true) {
-                    DeleteAtCursor(true);
-                    UpdateScrollOffset();
+                if (bounds.contains(event.mPosition) == true) {
+                    mCursorPos      = GetCursorPosFromMouseX(event.mPosition.x, pos_global);
+                    mSelectionStart = mSelectionEnd = 0;
+                    mCursorLastBlink                = Clock::GetNow();
                 }
+            }
 
-                if (controls.mKeyboard.IsKeyPressed(sf::Keyboard::Key::Enter) == true) {
-                    if (mOnEnterPressed) {
-                        mOnEnterPressed();
-                    }
+            if (mState != TextboxState::Focused) {
+                if (bounds.contains(controls.mMouse.mPosition) == true) {
+                    mState = TextboxState::Hover;
                 }
-
-                if (controls.mKeyboard.mIsCPressed == true && controls.mKeyboard.IsKeyPressed(sf::Keyboard::Key::A) == true) {
-                    mSelectionStart = 0;
-                    mSelectionEnd   = mText.getSize();
+                else {
+                    mState = TextboxState::Normal;
                 }
+            }
 
-                // TODO: Ctrl+C, Ctrl+V, Ctrl+X
-
-                auto  now     = std::chrono::steady_clock::now();
-                float elapsed = std::chrono::duration<float>(now - mCursorLastBlink).count();
-
-                if (elapsed >= mCursorBlinkInterval) {
-                    mIsCursorVisible = !mIsCursorVisible;
-                    mCursorLastBlink = now;
-                }
+            if (mState != state_prev || mCursorPos != cursor_prev) {
+                MarkChanged();
             }
         }
 
@@ -658,77 +813,964 @@ namespace Orbis {
                 text_pos.x += mPadding - mScrollOffset;
             }
 
-            if (mText.isEmpty() == true && mState != TextboxState::Focused) {
-                if (mPlaceholder.isEmpty() == false) {
-                    sf::Text      placeholder_text(*font, mPlaceholder, font_size);
-                    sf::FloatRect bounds = placeholder_text.getLocalBounds();
-                    sf::Vector2f  offset = {0, 0};
-
-                    if (text_align == TextAlign::CenterTop || text_align == TextAlign::Center || text_align == TextAlign::CenterBottom) {
-                        offset.x = -(bounds.size.x) / 2.0f;
-                    }
-                    else if (text_align == TextAlign::RightTop || text_align == TextAlign::RightCenter || text_align == TextAlign::RightBottom) {
-                        offset.x = -(bounds.size.x);
-                    }
+            RenderLayout layout;
+
+            layout.mTextRevision   = mTextRevision;
+            layout.mFont           = font.get();
+            layout.mFontSize       = font_size;
+            layout.mFillColor      = fill_color;
+            layout.mAlign          = text_align;
+            layout.mPosition       = text_pos;
+            layout.mCursorPos      = mCursorPos;
+            layout.mSelectionStart = mSelectionStart;
+            layout.mSelectionEnd   = mSelectionEnd;
+            layout.mIsFocused      = mState == TextboxState::Focused;
+
+            if (layout != mLayout) {
+                RebuildLayout(layout, *font);
+            }
 
-                    if (text_align == TextAlign::LeftCenter || text_align == TextAlign::Center || text_align == TextAlign::RightCenter) {
-                        offset.y = -(static_cast<float>(font_size)) / 2.0f;
-                    }
-                    else if (text_align == TextAlign::LeftBottom || text_align == TextAlign::CenterBottom || text_align == TextAlign::RightBottom) {
-                        offset.y = -(static_cast<float>(font_size));
-                    }
+            if (mIsPlaceholderShown == true) {
+                window.draw(mPlaceholderText.value());
 
-                    placeholder_text.setPosition(text_pos + offset);
-                    placeholder_text.setFillColor(sf::Color(150, 150, 150, 255));
-                    window.draw(placeholder_text);
+                return;
+            }
+
+            if (mText.IsEmpty() == true && layout.mIsFocused == false) {
+                return;
+            }
+
+            if (mIsHighlightShown == true) {
+                window.draw(mHighlightShape);
+            }
+
+            // Only the characters over the box, a long line scrolled sideways draws no more than a short one
+            mRun.Draw(window, mTextOrigin, pos_global.x - mTextOrigin.x, pos_global.x + mSize.x - mTextOrigin.x);
+
+            if (layout.mIsFocused == true && IsCursorVisible() == true) {
+                window.draw(mCursorShape);
+            }
+        }
+    };
+
+    // Many-line editor for config files and scripts. The document is one gap buffer with an index of where every line
+    // starts, so an edit costs the characters it moves plus one pass over the starts after it; only the edited line is
+    // laid out again, and only the lines in view are laid out at all.
+    class TextboxMulti : public Widget {
+    private:
+        std::function<void()> mOnTextChanged; // read the text back with GetTextContent(), which joins the document
+
+        GapBuffer           mText;
+        std::vector<size_t> mLineStarts = {0}; // index of the first character of every line, ascending
+        std::string         mIDEditable = "";
+        bool                mIsWideText = false;
+
+        mutable sf::String mTextContent;
+        mutable bool       mIsContentStale = false;
+
+        size_t mCursorPos      = 0;
+        size_t mSelectionStart = 0;
+        size_t mSelectionEnd   = 0;
+        float  mPreferredX     = -1.0f; // kept across Up and Down so the cursor returns to its column, negative when unset
+        bool   mIsDragging     = false;
+
+        TextboxState mState = TextboxState::Normal;
+
+        std::chrono::steady_clock::time_point mCursorLastBlink;
+        float                                 mCursorBlinkInterval = 0.5f;
+
+        size_t mFirstLine    = 0;    // topmost line in view
+        float  mScrollOffset = 0.0f; // horizontal
+        float  mPadding      = 0.0f;
+        size_t mScrollStep   = 3; // lines per wheel notch
+
+        // One line of the document, indexable like the strings GlyphRun lays out
+        struct LineView {
+            const GapBuffer& mText;
+            size_t           mStart;
+
+            char32_t operator[](size_t index) const {
+                return mText[mStart + index];
+            }
+        };
+
+        struct LineRun {
+            GlyphRun mRun;
+            bool     mIsValid = false;
+        };
+
+        // Layouts of the lines in view, from mRunsFirst on. Scrolling rotates them so lines that stay in view keep theirs.
+        std::vector<LineRun>      mRuns;
+        size_t                    mRunsFirst = 0;
+        GlyphRun                  mScratchRun; // a line outside the view, e.g. the cursor's after a wheel scroll
+        std::shared_ptr<sf::Font> mRunFont;
+        size_t                    mRunFontSize = 0;
+
+        std::vector<sf::Vertex> mHighlightVertices;
+        sf::RectangleShape      mCursorShape;
+
+        void GetEditableStyle(std::shared_ptr<sf::Font>& font, size_t& font_size, sf::Color& fill_color, sf::Vector2f& position) const {
+            if (mIsWideText == false) {
+                const DrawingsText& text_drawing = GetText(mIDEditable);
+
+                font       = text_drawing.mFont;
+                font_size  = text_drawing.mFontSize;
+                fill_color = text_drawing.mFillColor;
+                position   = text_drawing.mPosition;
+            }
+            else {
+                const DrawingsWText& text_drawing = GetWText(mIDEditable);
+
+                font       = text_drawing.mFont;
+                font_size  = text_drawing.mFontSize;
+                fill_color = text_drawing.mFillColor;
+                position   = text_drawing.mPosition;
+            }
+        }
+
+        // Picks up the editable drawing's font; every layout is dropped when it changes. False while there is none.
+        bool SyncRunFont() {
+            if (mIDEditable.empty() == true) {
+                return false;
+            }
+
+            std::shared_ptr<sf::Font> font;
+            size_t                    font_size;
+            sf::Color                 fill_color;
+            sf::Vector2f              position;
+
+            GetEditableStyle(font, font_size, fill_color, position);
+
+            if (font == nullptr) {
+                return false;
+            }
+
+            if (font != mRunFont || font_size != mRunFontSize) {
+                mRunFont     = std::move(font);
+                mRunFontSize = font_size;
+
+                for (LineRun& line_run : mRuns) {
+                    line_run.mIsValid = false;
+                }
+            }
+
+            return true;
+        }
+
+        size_t GetLineLength(size_t line) const {
+            size_t end = line + 1 < mLineStarts.size() ? mLineStarts[line + 1] - 1 : mText.GetSize();
+
+            return end - mLineStarts[line];
+        }
+
+        size_t GetLineOf(size_t position) const {
+            return static_cast<size_t>(std::upper_bound(mLineStarts.begin(), mLineStarts.end(), position) - mLineStarts.begin()) - 1;
+        }
+
+        float GetLineHeight() const {
+            return std::max(mRunFont->getLineSpacing(static_cast<unsigned int>(mRunFontSize)), 1.0f);
+        }
+
+        // Top-left of the first line in view relative to the widget, before horizontal scrolling
+        sf::Vector2f GetTextOffset() const {
+            std::shared_ptr<sf::Font> font;
+            size_t                    font_size;
+            sf::Color                 fill_color;
+            sf::Vector2f              position;
+
+            GetEditableStyle(font, font_size, fill_color, position);
+
+            return position + sf::Vector2f(mPadding, mPadding);
+        }
+
+        size_t GetVisibleLineCount() const {
+            float height = mSize.y - GetTextOffset().y - mPadding;
+
+            return std::max(static_cast<size_t>(std::max(height, 0.0f) / GetLineHeight()), size_t(1));
+        }
+
+        GlyphRun& GetLineRun(size_t line) {
+            LineView view{mText, mLineStarts[line]};
+
+            if (mRunsFirst <= line && line < mRunsFirst + mRuns.size()) {
+                LineRun& line_run = mRuns[line - mRunsFirst];
+
+                if (line_run.mIsValid == false) {
+                    line_run.mRun.Assign(view, GetLineLength(line), mRunFont, mRunFontSize);
+                    line_run.mIsValid = true;
+                }
+
+                return line_run.mRun;
+            }
+
+            mScratchRun.Assign(view, GetLineLength(line), mRunFont, mRunFontSize);
+
+            return mScratchRun;
+        }
+
+        // Moves the layout window to [first, first + count), without allocating once it has its size
+        void SlideRuns(size_t first, size_t count) {
+            if (mRuns.size() != count) {
+                mRuns.resize(count);
+
+                for (LineRun& line_run : mRuns) {
+                    line_run.mIsValid = false;
+                }
+            }
+            else if (mRunsFirst < first) {
+                size_t shift = std::min(first - mRunsFirst, count);
+
+                std::rotate(mRuns.begin(), mRuns.begin() + shift, mRuns.end());
+
+                for (size_t i = count - shift; i < count; ++i) {
+                    mRuns[i].mIsValid = false;
+                }
+            }
+            else if (first < mRunsFirst) {
+                size_t shift = std::min(mRunsFirst - first, count);
+
+                std::rotate(mRuns.rbegin(), mRuns.rbegin() + shift, mRuns.rend());
+
+                for (size_t i = 0; i < shift; ++i) {
+                    mRuns[i].mIsValid = false;
+                }
+            }
+
+            mRunsFirst = first;
+        }
+
+        // Keeps the view inside the document and the layout window on it
+        void ClampView() {
+            size_t visible = GetVisibleLineCount();
+            size_t count   = mLineStarts.size();
+
+            mFirstLine = std::min(mFirstLine, visible < count ? count - visible : size_t(0));
+
+            SlideRuns(mFirstLine, visible);
+        }
+
+        // Every edit ends here: `erased` characters at start became `inserted`, which may add or remove whole lines
+        void ReplaceRange(size_t start, size_t erased, std::u32string_view inserted) {
+            size_t line      = GetLineOf(start);
+            size_t line_last = GetLineOf(start + erased);
+            size_t column    = start - mLineStarts[line];
+            size_t removed   = line_last - line;
+            size_t added     = static_cast<size_t>(std::count(inserted.begin(), inserted.end(), U'\n'));
+
+            mText.Erase(start, erased);
+            mText.Insert(start, inserted);
+
+            // Starts of the joined lines go, the ones after move by the length change, and every new break adds one
+            mLineStarts.erase(mLineStarts.begin() + line + 1, mLineStarts.begin() + line_last + 1);
+
+            for (size_t i = line + 1; i < mLineStarts.size(); ++i) {
+                mLineStarts[i] = mLineStarts[i] + inserted.size() - erased;
+            }
+
+            mLineStarts.insert(mLineStarts.begin() + line + 1, added, 0);
+
+            for (size_t i = 0, next = line + 1; i < inserted.size(); ++i) {
+                if (inserted[i] == U'\n') {
+                    mLineStarts[next++] = start + i + 1;
+                }
+            }
+
+            OnLinesEdited(line, column, erased, inserted.size(), removed, added);
+
+            mIsContentStale = true;
+
+            MarkChanged();
+
+            if (mOnTextChanged) {
+                mOnTextChanged();
+            }
+        }
+
+        // Splices the edited line's layout when the edit stayed on it, otherwise shifts the layouts below by the lines
+        // it added or removed; only the edited line is laid out again
+        void OnLinesEdited(size_t line, size_t column, size_t erased, size_t inserted, size_t removed, size_t added) {
+            if (line < mRunsFirst || mRunsFirst + mRuns.size() <= line) {
+                for (LineRun& line_run : mRuns) {
+                    line_run.mIsValid = false;
                 }
 
                 return;
             }
 
-            sf::Text      display_text = sf::Text(*font, mText, font_size);
-            sf::FloatRect bounds       = display_text.getLocalBounds();
-            sf::Vector2f  offset       = {0, 0};
+            size_t index = line - mRunsFirst;
+            size_t count = mRuns.size();
 
-            if (text_align == TextAlign::CenterTop || text_align == TextAlign::Center || text_align == TextAlign::CenterBottom) {
-                offset.x = -(bounds.size.x) / 2.0f;
+            if (removed == 0 && added == 0) {
+                if (mRuns[index].mIsValid == true) {
+                    mRuns[index].mRun.Splice(LineView{mText, mLineStarts[line]}, GetLineLength(line), column, erased, inserted);
+                }
+
+                return;
             }
-            else if (text_align == TextAlign::RightTop || text_align == TextAlign::RightCenter || text_align == TextAlign::RightBottom) {
-                offset.x = -(bounds.size.x);
+
+            mRuns[index].mIsValid = false;
+
+            auto first_removed = mRuns.begin() + index + 1;
+
+            mRuns.erase(first_removed, first_removed + std::min(removed, count - index - 1));
+            mRuns.insert(mRuns.begin() + index + 1, std::min(added, count - index - 1), LineRun());
+            mRuns.resize(count);
+        }
+
+        void MoveCursorTo(size_t position, bool selecting) {
+            if (selecting == true) {
+                if (mSelectionStart == mSelectionEnd) {
+                    mSelectionStart = mCursorPos;
+                }
+
+                mSelectionEnd = position;
+            }
+            else {
+                mSelectionStart = mSelectionEnd = 0;
             }
 
-            if (text_align == TextAlign::LeftCenter || text_align == TextAlign::Center || text_align == TextAlign::RightCenter) {
-                offset.y = -(static_cast<float>(font_size)) / 2.0f;
+            mCursorPos = position;
+        }
+
+        // Same x on a line `delta` lines away, or the nearest position to it
+        size_t GetPosOnLine(ptrdiff_t delta) {
+            size_t line = GetLineOf(mCursorPos);
+
+            if (mPreferredX < 0.0f) {
+                mPreferredX = GetLineRun(line).GetCursorX(mCursorPos - mLineStarts[line]);
             }
-            else if (text_align == TextAlign::LeftBottom || text_align == TextAlign::CenterBottom || text_align == TextAlign::RightBottom) {
-                offset.y = -(static_cast<float>(font_size));
+
+            ptrdiff_t target = static_cast<ptrdiff_t>(line) + delta;
+
+            if (target < 0) {
+                return 0;
+            }
+
+            if (static_cast<ptrdiff_t>(mLineStarts.size()) <= target) {
+                return mText.GetSize();
+            }
+
+            size_t target_line = static_cast<size_t>(target);
+
+            return mLineStarts[target_line] + std::min(GetLineRun(target_line).GetIndexAt(mPreferredX), GetLineLength(target_line));
+        }
+
+        // Nearest position to a point in the window, lines above or below the view included
+        size_t GetPosAt(sf::Vector2f point, sf::Vector2f text_origin) {
+            float row  = std::floor((point.y - text_origin.y) / GetLineHeight());
+            float line = std::clamp(static_cast<float>(mFirstLine) + row, 0.0f, static_cast<float>(mLineStarts.size() - 1));
+
+            size_t target_line = static_cast<size_t>(line);
+
+            return mLineStarts[target_line] + GetLineRun(target_line).GetIndexAt(point.x - text_origin.x);
+        }
+
+        void DeleteSelection() {
+            size_t start = std::min(mSelectionStart, mSelectionEnd);
+            size_t end   = std::min(std::max(mSelectionStart, mSelectionEnd), mText.GetSize());
+
+            mCursorPos      = start;
+            mSelectionStart = mSelectionEnd = 0;
+
+            ReplaceRange(start, end - start, U"");
+        }
+
+        void InsertText(std::u32string_view text) {
+            if (mSelectionStart != mSelectionEnd) {
+                DeleteSelection();
+            }
+
+            size_t start = mCursorPos;
+
+            mCursorPos += text.size();
+
+            ReplaceRange(start, 0, text);
+        }
+
+        void DeleteAtCursor(bool forward) {
+            if (mSelectionStart != mSelectionEnd) {
+                DeleteSelection();
+                return;
+            }
+
+            if (forward == true) {
+                if (mCursorPos < mText.GetSize()) {
+                    ReplaceRange(mCursorPos, 1, U"");
+                }
+            }
+            else {
+                if (0 < mCursorPos) {
+                    mCursorPos--;
+
+                    ReplaceRange(mCursorPos, 1, U"");
+                }
+            }
+        }
+
+        void HandleKeyPressed(const InputEvent& event) {
+            bool   selecting   = event.mIsSPressed;
+            size_t line        = GetLineOf(mCursorPos);
+            float  preferred_x = -1.0f;
+
+            switch (event.mKey) {
+                case sf::Keyboard::Key::Left: {
+                    MoveCursorTo(0 < mCursorPos ? mCursorPos - 1 : 0, selecting);
+
+                    break;
+                }
+                case sf::Keyboard::Key::Right: {
+                    MoveCursorTo(std::min(mCursorPos + 1, mText.GetSize()), selecting);
+
+                    break;
+                }
+                case sf::Keyboard::Key::Up: {
+                    MoveCursorTo(GetPosOnLine(-1), selecting);
+
+                    preferred_x = mPreferredX;
+
+                    break;
+                }
+                case sf::Keyboard::Key::Down: {
+                    MoveCursorTo(GetPosOnLine(1), selecting);
+
+                    preferred_x = mPreferredX;
+
+                    break;
+                }
+                case sf::Keyboard::Key::PageUp: {
+                    ptrdiff_t page = static_cast<ptrdiff_t>(GetVisibleLineCount());
+
+                    MoveCursorTo(GetPosOnLine(-page), selecting);
+
+                    preferred_x = mPreferredX;
+                    mFirstLine  = mFirstLine - std::min(mFirstLine, static_cast<size_t>(page));
+
+                    break;
+                }
+                case sf::Keyboard::Key::PageDown: {
+                    ptrdiff_t page = static_cast<ptrdiff_t>(GetVisibleLineCount());
+
+                    MoveCursorTo(GetPosOnLine(page), selecting);
+
+                    preferred_x = mPreferredX;
+                    mFirstLine  = mFirstLine + static_cast<size_t>(page);
+
+                    break;
+                }
+                case sf::Keyboard::Key::Home: {
+                    MoveCursorTo(event.mIsCPressed == true ? 0 : mLineStarts[line], selecting);
+
+                    break;
+                }
+                case sf::Keyboard::Key::End: {
+                    MoveCursorTo(event.mIsCPressed == true ? mText.GetSize() : mLineStarts[line] + GetLineLength(line), selecting);
+
+                    break;
+                }
+                case sf::Keyboard::Key::Backspace: {
+                    DeleteAtCursor(false);
+
+                    break;
+                }
+                case sf::Keyboard::Key::Delete: {
+                    DeleteAtCursor(true);
+
+                    break;
+                }
+                case sf::Keyboard::Key::Enter: {
+                    InsertText(U"\n");
+
+                    break;
+                }
+                case sf::Keyboard::Key::A: {
+                    if (event.mIsCPressed == true) {
+                        mSelectionStart = 0;
+                        mSelectionEnd   = mText.GetSize();
+                        mCursorPos      = mText.GetSize();
+                    }
+
+                    break;
+                }
+                case sf::Keyboard::Key::C:
+                case sf::Keyboard::Key::X: {
+                    if (event.mIsCPressed == false || mSelectionStart == mSelectionEnd) {
+                        return;
+                    }
+
+                    size_t start = std::min(mSelectionStart, mSelectionEnd);
+                    size_t end   = std::min(std::max(mSelectionStart, mSelectionEnd), mText.GetSize());
+
+                    sf::Clipboard::setString(sf::String(mText.Substring(start, end - start)));
+
+                    if (event.mKey == sf::Keyboard::Key::X) {
+                        DeleteSelection();
+                    }
+
+                    break;
+                }
+                case sf::Keyboard::Key::V: {
+                    if (event.mIsCPressed == false) {
+                        return;
+                    }
+
+                    // Windows line breaks come in as "\r\n", only the '\n' starts a line here
+                    std::u32string pasted = sf::Clipboard::getString().toUtf32();
+
+                    pasted.erase(std::remove(pasted.begin(), pasted.end(), U'\r'), pasted.end());
+
+                    if (pasted.empty() == false) {
+                        InsertText(pasted);
+                    }
+
+                    break;
+                }
+                default: {
+                    return;
+                }
+            }
+
+            mPreferredX = preferred_x;
+
+            UpdateScrollOffset();
+        }
+
+        std::chrono::steady_clock::duration GetBlinkInterval() const {
+            return std::chrono::duration_cast<std::chrono::steady_clock::duration>(std::chrono::duration<float>(mCursorBlinkInterval));
+        }
+
+        bool IsCursorVisible() const {
+            auto interval = GetBlinkInterval();
+
+            if (interval.count() <= 0) {
+                return true;
+            }
+
+            return ((Clock::GetNow() - mCursorLastBlink) / interval) % 2 == 0;
+        }
+
+        // Scrolls just enough to bring the cursor into view, in lines vertically and in pixels sideways
+        void UpdateScrollOffset() {
+            if (mRunFont == nullptr) {
+                return;
+            }
+
+            size_t line    = GetLineOf(mCursorPos);
+            size_t visible = GetVisibleLineCount();
+
+            if (line < mFirstLine) {
+                mFirstLine = line;
+            }
+
+            if (mFirstLine + visible <= line) {
+                mFirstLine = line + 1 - visible;
+            }
+
+            ClampView();
+
+            float cursor_x      = GetLineRun(line).GetCursorX(mCursorPos - mLineStarts[line]);
+            float visible_width = mSize.x - GetTextOffset().x - mPadding;
+
+            if (visible_width < cursor_x - mScrollOffset) {
+                mScrollOffset = cursor_x - visible_width;
+            }
+
+            if (cursor_x < mScrollOffset) {
+                mScrollOffset = cursor_x;
+            }
+
+            if (mScrollOffset < 0.0f) {
+                mScrollOffset = 0.0f;
+            }
+        }
+
+        void PushQuad(sf::FloatRect rect, sf::Color color) {
+            sf::Vector2f top_left     = rect.position;
+            sf::Vector2f top_right    = rect.position + sf::Vector2f(rect.size.x, 0);
+            sf::Vector2f bottom_left  = rect.position + sf::Vector2f(0, rect.size.y);
+            sf::Vector2f bottom_right = rect.position + rect.size;
+
+            mHighlightVertices.push_back(sf::Vertex{top_left, color});
+            mHighlightVertices.push_back(sf::Vertex{top_right, color});
+            mHighlightVertices.push_back(sf::Vertex{bottom_left, color});
+            mHighlightVertices.push_back(sf::Vertex{bottom_left, color});
+            mHighlightVertices.push_back(sf::Vertex{top_right, color});
+            mHighlightVertices.push_back(sf::Vertex{bottom_right, color});
+        }
+
+    public:
+        TextboxMulti() = default;
+
+        bool IsContentEmpty() const {
+            return mText.IsEmpty();
+        }
+
+        // Joined from the gap buffer when asked for, so typing only pays for a whole string when someone reads it
+        const sf::String& GetTextContent() const {
+            if (mIsContentStale == true) {
+                mTextContent    = sf::String(mText.ToString());
+                mIsContentStale = false;
+            }
+
+            return mTextContent;
+        }
+
+        size_t GetLineCount() const {
+            return mLineStarts.size();
+        }
+
+        sf::String GetLine(size_t line) const {
+            if (mLineStarts.size() <= line) {
+                throw std::out_of_range("TextboxMulti: line " + std::to_string(line) + " out of range");
+            }
+
+            return sf::String(mText.Substring(mLineStarts[line], GetLineLength(line)));
+        }
+
+        size_t GetCursorLine() const {
+            return GetLineOf(mCursorPos);
+        }
+
+        size_t GetCursorColumn() const {
+            return mCursorPos - mLineStarts[GetLineOf(mCursorPos)];
+        }
+
+        DrawingsText& GetText(const std::string& id) const {
+            auto iter = mDrawingsText.find(id);
+
+            if (iter == mDrawingsText.end()) {
+                throw std::runtime_error("DrawingsText with id '" + id + "' not found");
+            }
+
+            return *iter->second;
+        }
+
+        DrawingsWText& GetWText(const std::string& id) const {
+            auto iter = mDrawingsWText.find(id);
+
+            if (iter == mDrawingsWText.end()) {
+                throw std::runtime_error("DrawingsWText with id '" + id + "' not found");
+            }
+
+            return *iter->second;
+        }
+
+        TextboxMulti& SetOnTextChanged(std::function<void()> callback) {
+            mOnTextChanged = std::move(callback);
+
+            return *this;
+        }
+
+        // The drawing only supplies font, size, color and position; its own string is never drawn or updated
+        TextboxMulti& SetEditableText(const std::string& text_id) {
+            mIDEditable = text_id;
+            mIsWideText = false;
+
+            MarkChanged();
+
+            return *this;
+        }
+
+        TextboxMulti& SetEditableWText(const std::string& wtext_id) {
+            mIDEditable = wtext_id;
+            mIsWideText = true;
+
+            MarkChanged();
+
+            return *this;
+        }
+
+        TextboxMulti& SetCursorBlinkInterval(float seconds) {
+            mCursorBlinkInterval = seconds;
+
+            return *this;
+        }
+
+        TextboxMulti& SetPadding(float padding) {
+            mPadding = padding;
+
+            MarkChanged();
+
+            return *this;
+        }
+
+        TextboxMulti& SetScrollStep(size_t lines) {
+            mScrollStep = lines;
+
+            return *this;
+        }
+
+        // Replaces the whole document, indexed in one pass; the cursor goes to the start
+        TextboxMulti& SetText(const sf::String& text) {
+            mText.Assign(text.toUtf32());
+
+            mLineStarts.assign(1, 0);
+
+            for (size_t i = 0; i < mText.GetSize(); ++i) {
+                if (mText[i] == U'\n') {
+                    mLineStarts.push_back(i + 1);
+                }
+            }
+
+            for (LineRun& line_run : mRuns) {
+                line_run.mIsValid = false;
+            }
+
+            mCursorPos      = 0;
+            mSelectionStart = mSelectionEnd = 0;
+            mPreferredX     = -1.0f;
+            mFirstLine      = 0;
+            mScrollOffset   = 0.0f;
+            mIsContentStale = true;
+
+            MarkChanged();
+
+            if (mOnTextChanged) {
+                mOnTextChanged();
+            }
+
+            return *this;
+        }
+
+        TextboxMulti& ClearText() {
+            return SetText("");
+        }
+
+        std::shared_ptr<Widget> CloneImpl() const override {
+            auto cloned = std::make_shared<TextboxMulti>();
+
+            cloned->mSize                = mSize;
+            cloned->mPosition            = mPosition;
+            cloned->mZLevel              = mZLevel;
+            cloned->mIsVisible           = mIsVisible;
+            cloned->mText                = mText;
+            cloned->mLineStarts          = mLineStarts;
+            cloned->mIsContentStale      = true;
+            cloned->mIDEditable          = mIDEditable;
+            cloned->mIsWideText          = mIsWideText;
+            cloned->mCursorBlinkInterval = mCursorBlinkInterval;
+            cloned->mPadding             = mPadding;
+            cloned->mScrollStep          = mScrollStep;
+            cloned->mOnTextChanged       = mOnTextChanged;
+
+            CloneDrawingsTo(cloned.get());
+
+            return cloned;
+        }
+
+        bool IsFocusable() const override {
+            return true;
+        }
+
+        void OnFocusChanged(bool is_focused) override {
+            mState          = is_focused ? TextboxState::Focused : TextboxState::Normal;
+            mSelectionStart = mSelectionEnd = 0;
+            mCursorLastBlink                = Clock::GetNow();
+
+            MarkChanged();
+        }
+
+        bool HasCapture() const override {
+            return mIsDragging;
+        }
+
+        void HandleKeyEvent(const InputEvent& event) override {
+            if (mIsVisible == false || mState != TextboxState::Focused || SyncRunFont() == false) {
+                return;
+            }
+
+            size_t cursor_prev          = mCursorPos;
+            size_t selection_start_prev = mSelectionStart;
+            size_t selection_end_prev   = mSelectionEnd;
+            size_t first_line_prev      = mFirstLine;
+
+            if (event.mType == InputType::TextEntered) {
+                char32_t code = event.mUnicode;
+
+                mPreferredX = -1.0f;
+
+                InsertText(std::u32string_view(&code, 1));
+                UpdateScrollOffset();
+            }
+            else if (event.mType == InputType::KeyPressed) {
+                HandleKeyPressed(event);
+            }
+            else {
+                return;
+            }
+
+            mCursorLastBlink = Clock::GetNow();
+
+            if (mCursorPos != cursor_prev || mSelectionStart != selection_start_prev || mSelectionEnd != selection_end_prev || mFirstLine != first_line_prev) {
+                MarkChanged();
+            }
+        }
+
+        std::optional<std::chrono::steady_clock::time_point> GetNextDeadline() const override {
+            auto interval = GetBlinkInterval();
+
+            if (mState != TextboxState::Focused || interval.count() <= 0) {
+                return Widget::GetNextDeadline();
             }
 
-            if (mSelectionStart != mSelectionEnd && mState == TextboxState::Focused) {
-                size_t             selection_start  = std::min(mSelectionStart, mSelectionEnd);
-                size_t             selection_end    = std::max(mSelectionStart, mSelectionEnd);
-                sf::Text           selection_before = sf::Text(*font, mText.substring(0, selection_start), font_size);
-                sf::Text           selected         = sf::Text(*font, mText.substring(selection_start, selection_end - selection_start), font_size);
-                float              before_width     = selection_before.getLocalBounds().size.x;
-                float              sel_width        = selected.getLocalBounds().size.x;
-                sf::RectangleShape highlight        = sf::RectangleShape({sel_width, static_cast<float>(font_size)});
+            auto phases = (Clock::GetNow() - mCursorLastBlink) / interval;
 
-                highlight.setPosition({text_pos.x + offset.x + before_width, text_pos.y + offset.y});
-                highlight.setFillColor(sf::Color(100, 150, 255, 128));
-                window.draw(highlight);
+            return Anim::GetEarlier(Widget::GetNextDeadline(), mCursorLastBlink + interval * (phases + 1));
+        }
+
+        // Pointer only: click to place the cursor, drag or Shift+click to select, wheel to scroll
+        void UpdateImpl(const Controls& controls, sf::Vector2f pos_panel) override {
+            if (mIsVisible == false || SyncRunFont() == false) {
+                return;
             }
 
-            display_text.setPosition(text_pos + offset);
-            display_text.setFillColor(fill_color);
-            window.draw(display_text);
+            sf::Vector2f  pos_global = pos_panel + mPosition;
+            sf::FloatRect bounds(pos_global, mSize);
+            sf::Vector2f  text_origin = pos_global + GetTextOffset() - sf::Vector2f(mScrollOffset, 0);
+
+            TextboxState state_prev         = mState;
+            size_t       cursor_prev        = mCursorPos;
+            size_t       selection_end_prev = mSelectionEnd;
+            size_t       first_line_prev    = mFirstLine;
+
+            ClampView();
 
-            if (mState == TextboxState::Focused && mIsCursorVisible == true) {
-                float              cursor_x = text_pos.x + offset.x + GetCursorPosX();
-                sf::RectangleShape cursor   = sf::RectangleShape({2.0f, static_cast<float>(font_size)});
+            for (const InputEvent& event : controls.mEvents) {
+                if (event.mType == InputType::MousePressed && event.mButton == sf::Mouse::Button::Left) {
+                    if (bounds.contains(event.mPosition) == true) {
+                        size_t position = GetPosAt(event.mPosition, text_origin);
 
-                cursor.setPosition({cursor_x, text_pos.y + offset.y});
-                cursor.setFillColor(fill_color);
-                window.draw(cursor);
+                        // Shift extends from the current selection's anchor, a plain click starts a new one
+                        if (event.mIsSPressed == false) {
+                            mSelectionStart = position;
+                        }
+                        else if (mSelectionStart == mSelectionEnd) {
+                            mSelectionStart = mCursorPos;
+                        }
+
+                        mCursorPos       = position;
+                        mSelectionEnd    = position;
+                        mPreferredX      = -1.0f;
+                        mIsDragging      = true;
+                        mCursorLastBlink = Clock::GetNow();
+                    }
+                }
+                else if (event.mType == InputType::MouseMoved && mIsDragging == true) {
+                    mCursorPos    = GetPosAt(event.mPosition, text_origin);
+                    mSelectionEnd = mCursorPos;
+                }
+                else if (event.mType == InputType::MouseReleased && event.mButton == sf::Mouse::Button::Left) {
+                    mIsDragging = false;
+                }
+                else if (event.mType == InputType::MouseWheel && bounds.contains(event.mPosition) == true) {
+                    size_t lines = static_cast<size_t>(std::abs(event.mWheelDelta) * static_cast<float>(mScrollStep));
+
+                    mFirstLine = 0.0f < event.mWheelDelta ? mFirstLine - std::min(mFirstLine, lines) : mFirstLine + lines;
+
+                    ClampView();
+                }
+            }
+
+            if (mState != TextboxState::Focused) {
+                if (bounds.contains(controls.mMouse.mPosition) == true) {
+                    mState = TextboxState::Hover;
+                }
+                else {
+                    mState = TextboxState::Normal;
+                }
+            }
+
+            if (mState != state_prev || mCursorPos != cursor_prev || mSelectionEnd != selection_end_prev || mFirstLine != first_line_prev) {
+                MarkChanged();
+            }
+        }
+
+        // Lays out and draws only the lines in view, each clipped to the box sideways
+        void RenderImpl(sf::RenderWindow& window, sf::Vector2f pos_panel) override {
+            if (mIsVisible == false) {
+                return;
+            }
+
+            sf::Vector2f pos_global = pos_panel + mPosition;
+
+            RenderAllDrawingsSkipEditable(window, pos_global, mIDEditable);
+
+            if (SyncRunFont() == false) {
+                return;
+            }
+
+            ClampView();
+
+            std::shared_ptr<sf::Font> font;
+            size_t                    font_size;
+            sf::Color                 fill_color;
+            sf::Vector2f              drawing_position;
+
+            GetEditableStyle(font, font_size, fill_color, drawing_position);
+
+            sf::Vector2f text_offset = drawing_position + sf::Vector2f(mPadding, mPadding);
+            sf::Vector2f text_origin = pos_global + text_offset - sf::Vector2f(mScrollOffset, 0);
+            float        clip_left   = mScrollOffset;
+            float        clip_right  = mScrollOffset + mSize.x - text_offset.x - mPadding;
+            float        line_height = GetLineHeight();
+            size_t       line_end    = std::min(mFirstLine + mRuns.size(), mLineStarts.size());
+            bool         is_focused  = mState == TextboxState::Focused;
+
+            if (is_focused == true && mSelectionStart != mSelectionEnd) {
+                size_t    selection_start = std::min(mSelectionStart, mSelectionEnd);
+                size_t    selection_end   = std::max(mSelectionStart, mSelectionEnd);
+                float     newline_width   = static_cast<float>(font_size) / 3.0f; // a selected line break shows as a sliver
+                sf::Color color(100, 150, 255, 128);
+
+                mHighlightVertices.clear();
+
+                for (size_t line = mFirstLine; line < line_end; ++line) {
+                    size_t line_start = mLineStarts[line];
+                    size_t line_stop  = line_start + GetLineLength(line);
+
+                    if (selection_end < line_start || line_stop < selection_start) {
+                        continue;
+                    }
+
+                    GlyphRun& run = GetLineRun(line);
+
+                    float left  = run.GetCursorX(std::max(selection_start, line_start) - line_start);
+                    float right = run.GetCursorX(std::min(selection_end, line_stop) - line_start);
+
+                    if (line_stop < selection_end) {
+                        right += newline_width;
+                    }
+
+                    if (left < right) {
+                        float top = text_origin.y + static_cast<float>(line - mFirstLine) * line_height;
+
+                        PushQuad(sf::FloatRect({text_origin.x + left, top}, {right - left, line_height}), color);
+                    }
+                }
+
+                if (mHighlightVertices.empty() == false) {
+                    window.draw(mHighlightVertices.data(), mHighlightVertices.size(), sf::PrimitiveType::Triangles);
+                }
+            }
+
+            for (size_t line = mFirstLine; line < line_end; ++line) {
+                GlyphRun& run = GetLineRun(line);
+
+                run.SetColor(fill_color);
+                run.Draw(window, {text_origin.x, text_origin.y + static_cast<float>(line - mFirstLine) * line_height}, clip_left, clip_right);
+            }
+
+            size_t cursor_line = GetLineOf(mCursorPos);
+
+            if (is_focused == true && mFirstLine <= cursor_line && cursor_line < line_end && IsCursorVisible() == true) {
+                float cursor_x = GetLineRun(cursor_line).GetCursorX(mCursorPos - mLineStarts[cursor_line]);
+
+                if (clip_left <= cursor_x && cursor_x <= clip_right) {
+                    mCursorShape.setSize({2.0f, static_cast<float>(font_size)});
+                    mCursorShape.setPosition({text_origin.x + cursor_x, text_origin.y + static_cast<float>(cursor_line - mFirstLine) * line_height});
+                    mCursorShape.setFillColor(fill_color);
+
+                    window.draw(mCursorShape);
+                }
             }
         }
     };
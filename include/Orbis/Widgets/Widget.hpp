@@ -1,17 +1,23 @@
 #pragma once
 
+#include <algorithm>
 #include <chrono>
 #include <cmath>
 #include <functional>
 #include <map>
 #include <memory>
 #include <optional>
+#include <span>
+#include <vector>
 
 #include <SFML/Graphics.hpp>
 
 #include "Orbis/Anim.hpp"
+#include "Orbis/System/AnimationScheduler.hpp"
+#include "Orbis/System/ChangeCounter.hpp"
 #include "Orbis/System/Controls.hpp"
 #include "Orbis/System/Drawings.hpp"
+#include "Orbis/System/QuadBatch.hpp"
 
 namespace Orbis {
     class Widget;
@@ -20,61 +26,222 @@ namespace Orbis {
     class Slider;
     class TextboxSingle;
     class TextboxMulti;
+    class ScrollView;
+    class LogConsole;
 
-    class Widget : public std::enable_shared_from_this<Widget> {
+    // Widgets with tweens requested since their panel last handed them to a scheduler, shared by the panel with its widgets
+    using SubmitList = std::vector<std::weak_ptr<Widget>>;
+
+    // Slots of the widgets a panel holds directly that changed since its last update, shared by the panel with those widgets
+    using DirtyList = std::vector<uint32_t>;
+
+    class Widget : public std::enable_shared_from_this<Widget>, public Animatable {
     protected:
         sf::Vector2f mSize      = {0, 0};
         sf::Vector2f mPosition  = {0, 0};
         size_t       mZLevel    = 0;
         bool         mIsVisible = true;
+        uint32_t     mRevision  = 0; // bumped whenever hit bounds or zlevel change
+
+        std::shared_ptr<ChangeCounter> mChanges; // the owning panel's, empty until the widget joins one
+        std::shared_ptr<SubmitList>    mSubmits; // the owning panel's too
+        bool                           mIsSubmitQueued = false;
+
+        std::shared_ptr<DirtyList> mDirty; // the owning panel's, left empty for the children of containers
+        uint32_t                   mDirtySlot     = 0;
+        bool                       mIsDirtyQueued = false;
 
         std::map<std::string, std::shared_ptr<DrawingsLine>>    mDrawingsLine;
         std::map<std::string, std::shared_ptr<DrawingsRect>>    mDrawingsRect;
         std::map<std::string, std::shared_ptr<DrawingsText>>    mDrawingsText;
         std::map<std::string, std::shared_ptr<DrawingsWText>>   mDrawingsWText;
         std::map<std::string, std::shared_ptr<DrawingsTexture>> mDrawingsTexture;
+        std::map<std::string, std::shared_ptr<DrawingsSprite>>  mDrawingsSprite;
 
     protected:
-        using ColorModifier = std::function<sf::Color(DrawingType, const sf::Color&)>;
+        // A plain function rather than std::function, so rendering with a modifier never allocates
+        using ColorModifier = sf::Color (*)(const Widget& widget, DrawingType type, const sf::Color& original);
+
+        TweenQueue mTweens; // requested animations, until the owning panel hands them to its context's scheduler
+
+        std::vector<Drawings*> mDrawOrder; // every drawing sorted by zlevel, rebuilt only after drawings are added or handed out
+        bool                   mIsDrawOrderDirty = true;
+
+        // Also queues the widget once on its panel's dirty list, so the panel only looks at widgets that changed
+        void MarkChanged() {
+            if (mChanges != nullptr) {
+                mChanges->Bump();
+            }
+
+            if (mIsDirtyQueued == false && mDirty != nullptr) {
+                mDirty->push_back(mDirtySlot);
+
+                mIsDirtyQueued = true;
+            }
+        }
+
+        // After requesting a tween: queues the widget once until its next submit, so a hidden panel submits only queued widgets
+        void MarkRequested() {
+            MarkChanged();
+
+            if (mIsSubmitQueued == false && mSubmits != nullptr) {
+                mSubmits->push_back(weak_from_this());
+
+                mIsSubmitQueued = true;
+            }
+        }
+
+        void InvalidateBounds() {
+            ++mRevision;
 
-        std::optional<AnimationState> mPosAnimation;
-        std::optional<AnimationState> mScaleAnimation;
+            MarkChanged();
+        }
+
+        void BindDrawingChanges() {
+            for (const auto& [id, drawing] : mDrawingsLine) {
+                drawing->mChanges = mChanges;
+            }
+
+            for (const auto& [id, drawing] : mDrawingsRect) {
+                drawing->mChanges = mChanges;
+            }
+
+            for (const auto& [id, drawing] : mDrawingsText) {
+                drawing->mChanges = mChanges;
+            }
 
-        void RenderDrawing(sf::RenderWindow& window, const std::shared_ptr<Drawings>& drawing, sf::Vector2f pos_widget, const ColorModifier& color_modifier = nullptr) {
-            sf::Vector2f pos_drawing = pos_widget + drawing->mPosition;
+            for (const auto& [id, drawing] : mDrawingsWText) {
+                drawing->mChanges = mChanges;
+            }
+
+            for (const auto& [id, drawing] : mDrawingsTexture) {
+                drawing->mChanges = mChanges;
+            }
+
+            for (const auto& [id, drawing] : mDrawingsSprite) {
+                drawing->mChanges = mChanges;
+            }
+        }
+
+        void RebuildDrawOrder() {
+            mDrawOrder.clear();
+
+            for (const auto& [id, drawing] : mDrawingsLine) {
+                mDrawOrder.push_back(drawing.get());
+            }
+
+            for (const auto& [id, drawing] : mDrawingsRect) {
+                mDrawOrder.push_back(drawing.get());
+            }
+
+            for (const auto& [id, drawing] : mDrawingsText) {
+                mDrawOrder.push_back(drawing.get());
+            }
+
+            for (const auto& [id, drawing] : mDrawingsWText) {
+                mDrawOrder.push_back(drawing.get());
+            }
+
+            for (const auto& [id, drawing] : mDrawingsTexture) {
+                mDrawOrder.push_back(drawing.get());
+            }
+
+            for (const auto& [id, drawing] : mDrawingsSprite) {
+                mDrawOrder.push_back(drawing.get());
+            }
+
+            std::sort(mDrawOrder.begin(), mDrawOrder.end(), [](const Drawings* a, const Drawings* b) {
+                return a->mZLevel < b->mZLevel;
+            });
+
+            mIsDrawOrderDirty = false;
+        }
+
+        void RenderTextDrawing(sf::RenderWindow& window, sf::Text& text, size_t font_size, TextAlign align, sf::Color fill_color, sf::Vector2f pos_drawing) {
+            sf::FloatRect bounds = text.getLocalBounds();
+
+            float offset_x = 0.0f;
+            float offset_y = 0.0f;
+
+            if (align == TextAlign::CenterTop || align == TextAlign::Center || align == TextAlign::CenterBottom) {
+                offset_x = -(bounds.size.x) / 2.0f;
+            }
+            else if (align == TextAlign::RightTop || align == TextAlign::RightCenter || align == TextAlign::RightBottom) {
+                offset_x = -(bounds.size.x);
+            }
+
+            if (align == TextAlign::LeftCenter || align == TextAlign::Center || align == TextAlign::RightCenter) {
+                offset_y = -(static_cast<float>(font_size)) / 2.0f;
+            }
+            else if (align == TextAlign::LeftBottom || align == TextAlign::CenterBottom || align == TextAlign::RightBottom) {
+                offset_y = -(static_cast<float>(font_size));
+            }
+
+            text.setPosition(pos_drawing + sf::Vector2f(offset_x, offset_y));
+            text.setFillColor(fill_color);
+            window.draw(text);
+        }
+
+        // Draws what the panel batched so far, so that whatever is drawn next ends up above it
+        void FlushQuads(sf::RenderWindow& window) {
+            if (QuadBatch* batch = QuadBatch::GetCurrent(); batch != nullptr) {
+                batch->Flush(window);
+            }
+        }
+
+        // Into the panel's batch while it renders, drawn right away otherwise
+        void BatchQuad(sf::RenderWindow& window, const sf::Texture* texture, sf::FloatRect quad, sf::FloatRect coords, sf::Color color) {
+            if (QuadBatch* batch = QuadBatch::GetCurrent(); batch != nullptr) {
+                batch->Add(texture, quad, coords, color);
+            }
+            else {
+                QuadBatch::Draw(window, texture, quad, coords, color);
+            }
+        }
+
+        // Textures and sprites are batched; anything else draws after whatever was batched before it
+        void RenderDrawing(sf::RenderWindow& window, Drawings& drawing, sf::Vector2f pos_widget, ColorModifier color_modifier = nullptr) {
+            sf::Vector2f pos_drawing = pos_widget + drawing.mPosition;
+
+            if (drawing.mType != DrawingType::Texture && drawing.mType != DrawingType::Sprite) {
+                FlushQuads(window);
+            }
 
             auto get_color = [&](const sf::Color& original) -> sf::Color {
-                if (color_modifier) {
-                    return color_modifier(drawing->mType, original);
+                if (color_modifier != nullptr) {
+                    return color_modifier(*this, drawing.mType, original);
                 }
 
                 return original;
             };
 
-            switch (drawing->mType) {
+            switch (drawing.mType) {
                 case DrawingType::Line: {
-                    auto line = std::static_pointer_cast<DrawingsLine>(drawing);
+                    auto&            line     = static_cast<DrawingsLine&>(drawing);
+                    sf::VertexArray& vertices = line.mCachedVertices;
 
-                    if (line->mPoints.size() < 2) {
+                    if (line.mPoints.size() < 2) {
                         break;
                     }
 
-                    if (line->mThickness <= 1.0f) {
-                        sf::VertexArray curve(sf::PrimitiveType::LineStrip);
+                    // Cleared rather than rebuilt, so the vertex storage is reused from frame to frame
+                    vertices.clear();
 
-                        for (const auto& point : line->mPoints) {
-                            curve.append(sf::Vertex(pos_drawing + point, line->mFillColor));
-                        }
+                    if (line.mThickness <= 1.0f) {
+                        vertices.setPrimitiveType(sf::PrimitiveType::LineStrip);
 
-                        window.draw(curve);
+                        for (const auto& point : line.mPoints) {
+                            vertices.append(sf::Vertex(pos_drawing + point, line.mFillColor));
+                        }
                     }
                     else {
-                        sf::VertexArray line_thick     = sf::VertexArray(sf::PrimitiveType::Triangles);
-                        float           thickness_half = line->mThickness / 2.0f;
+                        float thickness_half = line.mThickness / 2.0f;
 
-                        for (size_t i = 0; i < line->mPoints.size() - 1; ++i) {
-                            sf::Vector2f p1        = pos_drawing + line->mPoints[i];
-                            sf::Vector2f p2        = pos_drawing + line->mPoints[i + 1];
+                        vertices.setPrimitiveType(sf::PrimitiveType::Triangles);
+
+                        for (size_t i = 0; i < line.mPoints.size() - 1; ++i) {
+                            sf::Vector2f p1        = pos_drawing + line.mPoints[i];
+                            sf::Vector2f p2        = pos_drawing + line.mPoints[i + 1];
                             sf::Vector2f direction = p2 - p1;
                             float        length    = std::sqrt(direction.x * direction.x + direction.y * direction.y);
 
@@ -89,210 +256,195 @@ namespace Orbis {
                             sf::Vector2f v3            = p2 - offset;
                             sf::Vector2f v4            = p2 + offset;
 
-                            line_thick.append(sf::Vertex(v1, line->mFillColor));
-                            line_thick.append(sf::Vertex(v2, line->mFillColor));
-                            line_thick.append(sf::Vertex(v3, line->mFillColor));
-                            line_thick.append(sf::Vertex(v1, line->mFillColor));
-                            line_thick.append(sf::Vertex(v3, line->mFillColor));
-                            line_thick.append(sf::Vertex(v4, line->mFillColor));
+                            vertices.append(sf::Vertex(v1, line.mFillColor));
+                            vertices.append(sf::Vertex(v2, line.mFillColor));
+                            vertices.append(sf::Vertex(v3, line.mFillColor));
+                            vertices.append(sf::Vertex(v1, line.mFillColor));
+                            vertices.append(sf::Vertex(v3, line.mFillColor));
+                            vertices.append(sf::Vertex(v4, line.mFillColor));
                         }
-
-                        window.draw(line_thick);
                     }
 
+                    window.draw(vertices);
+
                     break;
                 }
                 case DrawingType::Rect: {
                     // TODO : Implement Outlines
 
-                    auto      rect        = std::static_pointer_cast<DrawingsRect>(drawing);
-                    sf::Color state_color = get_color(rect->mFillColor);
+                    auto&      rect        = static_cast<DrawingsRect&>(drawing);
+                    sf::Color  state_color = get_color(rect.mFillColor);
+                    sf::Shape* shape       = nullptr;
 
-                    if (rect->mIsRounded == true) {
-                        sf::ConvexShape shape = sf::RectRounded(rect->mSize, rect->mRoundingRadius);
+                    if (rect.mIsRounded == true) {
+                        bool is_stale = rect.mCachedRoundedSize != rect.mSize || rect.mCachedRoundedRadius != rect.mRoundingRadius;
+
+                        if (rect.mCachedRounded.has_value() == false || is_stale == true) {
+                            if (rect.mCachedRounded.has_value() == false) {
+                                rect.mCachedRounded.emplace();
+                            }
 
-                        shape.setPosition(pos_drawing);
-                        shape.setFillColor(state_color);
+                            sf::RectRounded(rect.mCachedRounded.value(), rect.mSize, rect.mRoundingRadius);
 
-                        if (rect->mIsOutlined == true) {
-                            shape.setOutlineThickness(rect->mOutlineThickness);
-                            shape.setOutlineColor(rect->mOutlineColor);
+                            rect.mCachedRoundedSize   = rect.mSize;
+                            rect.mCachedRoundedRadius = rect.mRoundingRadius;
                         }
 
-                        window.draw(shape);
+                        shape = &rect.mCachedRounded.value();
                     }
                     else {
-                        sf::RectangleShape shape = sf::RectangleShape(rect->mSize);
+                        if (rect.mCachedShape.has_value() == false) {
+                            rect.mCachedShape.emplace(rect.mSize);
+                        }
+                        else if (rect.mCachedShape->getSize() != rect.mSize) {
+                            rect.mCachedShape->setSize(rect.mSize);
+                        }
 
-                        shape.setPosition(pos_drawing);
-                        shape.setFillColor(state_color);
+                        shape = &rect.mCachedShape.value();
+                    }
 
-                        if (rect->mIsOutlined == true) {
-                            shape.setOutlineThickness(rect->mOutlineThickness);
-                            shape.setOutlineColor(rect->mOutlineColor);
-                        }
+                    float outline_thickness = rect.mIsOutlined == true ? rect.mOutlineThickness : 0.0f;
 
-                        window.draw(shape);
+                    if (shape->getOutlineThickness() != outline_thickness) {
+                        shape->setOutlineThickness(outline_thickness);
                     }
 
+                    shape->setPosition(pos_drawing);
+                    shape->setFillColor(state_color);
+                    shape->setOutlineColor(rect.mOutlineColor);
+                    window.draw(*shape);
+
                     break;
                 }
                 case DrawingType::Text: {
-                    auto text_drawing = std::static_pointer_cast<DrawingsText>(drawing);
+                    auto& text_drawing = static_cast<DrawingsText&>(drawing);
 
-                    if (text_drawing->mCachedText.has_value() == false) {
-                        text_drawing->mCachedText = sf::Text(*text_drawing->mFont, text_drawing->mText, text_drawing->mFontSize);
+                    if (text_drawing.mCachedText.has_value() == false) {
+                        text_drawing.mCachedText = sf::Text(*text_drawing.mFont, text_drawing.mText, text_drawing.mFontSize);
                     }
 
-                    sf::Text&     text   = text_drawing->mCachedText.value();
-                    sf::FloatRect bounds = text.getLocalBounds();
-                    sf::Vector2f  offset = {0, 0};
-
-                    float offset_x = 0.0f;
-                    float offset_y = 0.0f;
+                    RenderTextDrawing(window, text_drawing.mCachedText.value(), text_drawing.mFontSize, text_drawing.mAlign, text_drawing.mFillColor, pos_drawing);
 
-                    if (text_drawing->mAlign == TextAlign::CenterTop || text_drawing->mAlign == TextAlign::Center || text_drawing->mAlign == TextAlign::CenterBottom) {
-                        offset_x = -(bounds.size.x) / 2.0f;
-                    }
-                    else if (text_drawing->mAlign == TextAlign::RightTop || text_drawing->mAlign == TextAlign::RightCenter || text_drawing->mAlign == TextAlign::RightBottom) {
-                        offset_x = -(bounds.size.x);
-                    }
+                    break;
+                }
+                case DrawingType::WText: {
+                    auto& text_drawing = static_cast<DrawingsWText&>(drawing);
 
-                    if (text_drawing->mAlign == TextAlign::LeftCenter || text_drawing->mAlign == TextAlign::Center || text_drawing->mAlign == TextAlign::RightCenter) {
-                        offset_y = -(static_cast<float>(text_drawing->mFontSize)) / 2.0f;
+                    if (text_drawing.mCachedText.has_value() == false) {
+                        text_drawing.mCachedText = sf::Text(*text_drawing.mFont, text_drawing.mWText, text_drawing.mFontSize);
                     }
-                    else if (text_drawing->mAlign == TextAlign::LeftBottom || text_drawing->mAlign == TextAlign::CenterBottom || text_drawing->mAlign == TextAlign::RightBottom) {
-                        offset_y = -(static_cast<float>(text_drawing->mFontSize));
-                    }
-
-                    offset = {offset_x, offset_y};
 
-                    text.setPosition(pos_drawing + offset);
-                    text.setFillColor(text_drawing->mFillColor);
-                    window.draw(text);
+                    RenderTextDrawing(window, text_drawing.mCachedText.value(), text_drawing.mFontSize, text_drawing.mAlign, text_drawing.mFillColor, pos_drawing);
 
                     break;
                 }
-                case DrawingType::WText: {
-                    auto text_drawing = std::static_pointer_cast<DrawingsWText>(drawing);
-
-                    if (text_drawing->mCachedText.has_value() == false) {
-                        text_drawing->mCachedText = sf::Text(*text_drawing->mFont, text_drawing->mWText, text_drawing->mFontSize);
-                    }
+                case DrawingType::Texture: {
+                    auto& texture = static_cast<DrawingsTexture&>(drawing);
 
-                    sf::Text&     text   = text_drawing->mCachedText.value();
-                    sf::FloatRect bounds = text.getLocalBounds();
-                    sf::Vector2f  offset = {0, 0};
+                    // Scaled around the center of the rect; without a texture it is a plain colored rect
+                    sf::Vector2f  size_scaled  = {texture.mSize.x * texture.mScale.x, texture.mSize.y * texture.mScale.y};
+                    sf::Vector2f  center       = pos_drawing + texture.mSize / 2.0f;
+                    sf::Vector2u  size_texture = texture.mTexture != nullptr ? texture.mTexture->getSize() : sf::Vector2u(0, 0);
+                    sf::FloatRect coords       = {{0.0f, 0.0f}, {static_cast<float>(size_texture.x), static_cast<float>(size_texture.y)}};
 
-                    float offset_x = 0.0f;
-                    float offset_y = 0.0f;
+                    BatchQuad(window, texture.mTexture.get(), {center - size_scaled / 2.0f, size_scaled}, coords, get_color(texture.mFillColor));
 
-                    if (text_drawing->mAlign == TextAlign::CenterTop || text_drawing->mAlign == TextAlign::Center || text_drawing->mAlign == TextAlign::CenterBottom) {
-                        offset_x = -(bounds.size.x) / 2.0f;
-                    }
-                    else if (text_drawing->mAlign == TextAlign::RightTop || text_drawing->mAlign == TextAlign::RightCenter || text_drawing->mAlign == TextAlign::RightBottom) {
-                        offset_x = -(bounds.size.x);
-                    }
+                    break;
+                }
+                case DrawingType::Sprite: {
+                    auto& sprite = static_cast<DrawingsSprite&>(drawing);
 
-                    if (text_drawing->mAlign == TextAlign::LeftCenter || text_drawing->mAlign == TextAlign::Center || text_drawing->mAlign == TextAlign::RightCenter) {
-                        offset_y = -(static_cast<float>(text_drawing->mFontSize)) / 2.0f;
-                    }
-                    else if (text_drawing->mAlign == TextAlign::LeftBottom || text_drawing->mAlign == TextAlign::CenterBottom || text_drawing->mAlign == TextAlign::RightBottom) {
-                        offset_y = -(static_cast<float>(text_drawing->mFontSize));
+                    if (sprite.mTexture == nullptr || sprite.mFrameCount == 0) {
+                        break;
                     }
 
-                    offset = {offset_x, offset_y};
+                    sf::IntRect   frame  = sprite.GetFrameRect(sprite.GetFrame(Clock::GetNow()));
+                    sf::FloatRect coords = {{static_cast<float>(frame.position.x), static_cast<float>(frame.position.y)}, {static_cast<float>(frame.size.x), static_cast<float>(frame.size.y)}};
 
-                    text.setPosition(pos_drawing + offset);
-                    text.setFillColor(text_drawing->mFillColor);
-                    window.draw(text);
-
-                    break;
-                }
-                case DrawingType::Texture: {
-                    auto               texture     = std::static_pointer_cast<DrawingsTexture>(drawing);
-                    sf::Color          final_color = get_color(texture->mFillColor);
-                    sf::RectangleShape shape       = sf::RectangleShape(texture->mSize);
-
-                    shape.setPosition(pos_drawing);
-                    shape.setTexture(texture->mTexture.get());
-                    shape.setFillColor(final_color);
-                    shape.setScale(texture->mScale);
-                    shape.setOrigin({texture->mSize.x / 2.0f, texture->mSize.y / 2.0f});
-                    shape.move({texture->mSize.x / 2.0f, texture->mSize.y / 2.0f});
-                    window.draw(shape);
+                    BatchQuad(window, sprite.mTexture.get(), {pos_drawing, sprite.mSize}, coords, get_color(sprite.mFillColor));
 
                     break;
                 }
             }
         }
 
-        void RenderAllDrawings(sf::RenderWindow& window, sf::Vector2f pos_widget, const ColorModifier& color_modifier = nullptr) {
-            std::vector<std::pair<size_t, std::shared_ptr<Drawings>>> all_drawings;
-
-            for (const auto& [id, drawing] : mDrawingsLine) {
-                all_drawings.push_back({drawing->mZLevel, drawing});
+        void RenderAllDrawings(sf::RenderWindow& window, sf::Vector2f pos_widget, ColorModifier color_modifier = nullptr) {
+            if (mIsDrawOrderDirty == true) {
+                RebuildDrawOrder();
             }
 
-            for (const auto& [id, drawing] : mDrawingsRect) {
-                all_drawings.push_back({drawing->mZLevel, drawing});
+            for (Drawings* drawing : mDrawOrder) {
+                RenderDrawing(window, *drawing, pos_widget, color_modifier);
             }
 
-            for (const auto& [id, drawing] : mDrawingsText) {
-                all_drawings.push_back({drawing->mZLevel, drawing});
+            if (IsQuadBatchable() == false) {
+                FlushQuads(window);
             }
+        }
 
-            for (const auto& [id, drawing] : mDrawingsWText) {
-                all_drawings.push_back({drawing->mZLevel, drawing});
+        void RenderAllDrawingsSkipEditable(sf::RenderWindow& window, sf::Vector2f pos_widget, const std::string& id_editable, ColorModifier color_modifier = nullptr) {
+            if (mIsDrawOrderDirty == true) {
+                RebuildDrawOrder();
             }
 
-            for (const auto& [id, drawing] : mDrawingsTexture) {
-                all_drawings.push_back({drawing->mZLevel, drawing});
-            }
+            for (Drawings* drawing : mDrawOrder) {
+                bool is_text = drawing->mType == DrawingType::Text || drawing->mType == DrawingType::WText;
 
-            std::sort(all_drawings.begin(), all_drawings.end(), [](const auto& a, const auto& b) {
-                return a.first < b.first;
-            });
+                if (is_text == true && drawing->mID == id_editable) {
+                    continue;
+                }
+
+                RenderDrawing(window, *drawing, pos_widget, color_modifier);
+            }
 
-            for (const auto& [zlevel, drawing] : all_drawings) {
-                RenderDrawing(window, drawing, pos_widget, color_modifier);
+            if (IsQuadBatchable() == false) {
+                FlushQuads(window);
             }
         }
 
-        void RenderAllDrawingsSkipEditable(sf::RenderWindow& window, sf::Vector2f pos_widget, std::string& id_editable, const ColorModifier& color_modifier = nullptr) {
-            std::vector<std::pair<size_t, std::shared_ptr<Drawings>>> all_drawings;
+        template <typename DT>
+        static const std::shared_ptr<DT>& FindDrawing(const std::map<std::string, std::shared_ptr<DT>>& drawings, const std::string& id) {
+            auto iter = drawings.find(id);
 
-            for (const auto& [id, drawing] : mDrawingsLine) {
-                all_drawings.push_back({drawing->mZLevel, drawing});
+            if (iter == drawings.end()) {
+                throw std::runtime_error("Drawing with id '" + id + "' not found");
             }
 
-            for (const auto& [id, drawing] : mDrawingsRect) {
-                all_drawings.push_back({drawing->mZLevel, drawing});
-            }
+            return iter->second;
+        }
 
-            for (const auto& [id, drawing] : mDrawingsText) {
-                if (id != id_editable) {
-                    all_drawings.push_back({drawing->mZLevel, drawing});
+        std::shared_ptr<Drawings> GetDrawing(DrawingType type, const std::string& id) const {
+            switch (type) {
+                case DrawingType::Line: {
+                    return FindDrawing(mDrawingsLine, id);
                 }
-            }
-
-            for (const auto& [id, drawing] : mDrawingsWText) {
-                if (id != id_editable) {
-                    all_drawings.push_back({drawing->mZLevel, drawing});
+                case DrawingType::Rect: {
+                    return FindDrawing(mDrawingsRect, id);
+                }
+                case DrawingType::Text: {
+                    return FindDrawing(mDrawingsText, id);
+                }
+                case DrawingType::WText: {
+                    return FindDrawing(mDrawingsWText, id);
+                }
+                case DrawingType::Texture: {
+                    return FindDrawing(mDrawingsTexture, id);
+                }
+                default: {
+                    return FindDrawing(mDrawingsSprite, id);
                 }
             }
+        }
 
-            for (const auto& [id, drawing] : mDrawingsTexture) {
-                all_drawings.push_back({drawing->mZLevel, drawing});
-            }
+        template <typename T>
+        Widget& DrawingAnimation(DrawingType type, const std::string& id, TweenProperty property, T from, T to, float duration, std::function<void()> on_complete, EasingCurve easing) {
+            std::shared_ptr<Drawings> drawing = GetDrawing(type, id);
 
-            std::sort(all_drawings.begin(), all_drawings.end(), [](const auto& a, const auto& b) {
-                return a.first < b.first;
-            });
+            mTweens.Push<T>(*drawing, drawing, property, from, to, duration, std::move(on_complete), std::move(easing));
 
-            for (const auto& [zlevel, drawing] : all_drawings) {
-                RenderDrawing(window, drawing, pos_widget, color_modifier);
-            }
+            MarkRequested();
+
+            return *this;
         }
 
         void CloneDrawingsTo(Widget* target) const {
@@ -325,49 +477,88 @@ namespace Orbis {
 
                 target->mDrawingsTexture[id] = cloned_drawing;
             }
-        }
 
-        void UpdateAnimation() {
-            if (mPosAnimation.has_value() == true) {
-                if (mPosAnimation->IsComplete() == true) {
-                    mPosition = mPosAnimation->mTargetPos;
+            for (const auto& [id, drawing] : mDrawingsSprite) {
+                auto cloned_drawing = std::make_shared<DrawingsSprite>(*drawing);
 
-                    if (mPosAnimation->mOnComplete) {
-                        mPosAnimation->mOnComplete();
-                    }
+                target->mDrawingsSprite[id] = cloned_drawing;
+            }
 
-                    mPosAnimation.reset();
-                }
-                else {
-                    mPosition = mPosAnimation->GetCurrentPosition();
-                }
+            target->mIsDrawOrderDirty = true;
+
+            target->BindDrawingChanges();
+        }
+
+    public:
+        virtual ~Widget() = default;
+
+        sf::Vector2f GetTextureScale() const {
+            if (mDrawingsTexture.empty() == true) {
+                return {1.0f, 1.0f};
             }
 
-            if (mScaleAnimation.has_value() == true) {
-                if (mScaleAnimation->IsComplete() == true) {
-                    for (auto& [id, texture] : mDrawingsTexture) {
-                        texture->mScale = mScaleAnimation->mTargetPos;
-                    }
+            return mDrawingsTexture.begin()->second->mScale;
+        }
 
-                    if (mScaleAnimation->mOnComplete) {
-                        mScaleAnimation->mOnComplete();
-                    }
+        // Set by the panel or container the widget is added to; mutations are reported to that counter from then on
+        virtual void BindChanges(const std::shared_ptr<ChangeCounter>& changes, const std::shared_ptr<SubmitList>& submits) {
+            mChanges        = changes;
+            mSubmits        = submits;
+            mIsSubmitQueued = false;
+            mDirty          = nullptr;
+            mIsDirtyQueued  = false;
 
-                    mScaleAnimation.reset();
-                }
-                else {
-                    sf::Vector2f current_scale = mScaleAnimation->GetCurrentPosition();
+            BindDrawingChanges();
+        }
+
+        // Set by a panel after BindChanges() for the widgets it holds directly; queues the widget right away
+        void BindDirty(const std::shared_ptr<DirtyList>& dirty, uint32_t slot) {
+            mDirty         = dirty;
+            mDirtySlot     = slot;
+            mIsDirtyQueued = false;
+
+            MarkChanged();
+        }
 
+        // Called by the owning panel as it takes the widget off its dirty list
+        void ClearDirty() {
+            mIsDirtyQueued = false;
+        }
+
+        // Called by the owning panel every update; self is the pointer the panel holds, which keeps batch widgets alive
+        virtual void SubmitAnimations(AnimationScheduler& scheduler, const std::shared_ptr<Widget>& self) {
+            scheduler.Submit(mTweens, self);
+
+            mIsSubmitQueued = false;
+        }
+
+        using Animatable::ApplyTween;
+
+        bool ApplyTween(TweenProperty property, sf::Vector2f value) override {
+            switch (property) {
+                case TweenProperty::Position: {
+                    mPosition = value;
+
+                    InvalidateBounds();
+                    break;
+                }
+                case TweenProperty::Scale: {
                     for (auto& [id, texture] : mDrawingsTexture) {
-                        texture->mScale = current_scale;
+                        texture->mScale = value;
                     }
+
+                    MarkChanged();
+                    break;
+                }
+                default: {
+                    return false;
                 }
             }
-        }
 
-    public:
-        virtual ~Widget() = default;
+            return true;
+        }
 
+        // Writes through the returned drawing don't wake an event-driven context, see UIContext::Invalidate()
         DrawingsRect& GetRect(const std::string& id) {
             auto iter = mDrawingsRect.find(id);
 
@@ -375,6 +566,8 @@ namespace Orbis {
                 throw std::runtime_error("DrawingsRect with id '" + id + "' not found");
             }
 
+            mIsDrawOrderDirty = true;
+
             return *iter->second;
         }
 
@@ -385,6 +578,8 @@ namespace Orbis {
                 throw std::runtime_error("DrawingsText with id '" + id + "' not found");
             }
 
+            mIsDrawOrderDirty = true;
+
             return *iter->second;
         }
 
@@ -395,6 +590,8 @@ namespace Orbis {
                 throw std::runtime_error("DrawingsWText with id '" + id + "' not found");
             }
 
+            mIsDrawOrderDirty = true;
+
             return *iter->second;
         }
 
@@ -405,9 +602,27 @@ namespace Orbis {
                 throw std::runtime_error("DrawingsTexture with id '" + id + "' not found");
             }
 
+            mIsDrawOrderDirty = true;
+
             return *iter->second;
         }
 
+        DrawingsSprite& GetSprite(const std::string& id) {
+            auto iter = mDrawingsSprite.find(id);
+
+            if (iter == mDrawingsSprite.end()) {
+                throw std::runtime_error("DrawingsSprite with id '" + id + "' not found");
+            }
+
+            mIsDrawOrderDirty = true;
+
+            return *iter->second;
+        }
+
+        bool HasSprites() const {
+            return mDrawingsSprite.empty() == false;
+        }
+
         sf::Vector2f GetPosition() const {
             return mPosition;
         }
@@ -424,27 +639,54 @@ namespace Orbis {
             return mIsVisible;
         }
 
+        uint32_t GetRevision() const {
+            return mRevision;
+        }
+
+        // Requested, or running on the widget itself or on any of its drawings
+        virtual bool IsAnimating() const {
+            if (mTweens.IsEmpty() == false || 0 < GetActiveTweens()) {
+                return true;
+            }
+
+            auto is_animating = [](const auto& drawings) {
+                return std::any_of(drawings.begin(), drawings.end(), [](const auto& entry) {
+                    return 0 < entry.second->GetActiveTweens();
+                });
+            };
+
+            return is_animating(mDrawingsLine) || is_animating(mDrawingsRect) || is_animating(mDrawingsText) || is_animating(mDrawingsWText) || is_animating(mDrawingsTexture) || is_animating(mDrawingsSprite);
+        }
+
         Widget& SetSize(sf::Vector2f size) {
             mSize = size;
 
+            InvalidateBounds();
+
             return *this;
         }
 
         Widget& SetPosition(sf::Vector2f position) {
             mPosition = position;
 
+            InvalidateBounds();
+
             return *this;
         }
 
         Widget& SetZLevel(size_t zlevel) {
             mZLevel = zlevel;
 
+            InvalidateBounds();
+
             return *this;
         }
 
         Widget& SetVisibility(bool visible) {
             mIsVisible = visible;
 
+            MarkChanged();
+
             return *this;
         }
 
@@ -457,9 +699,14 @@ namespace Orbis {
             drawing->mZLevel    = zlevel;
             drawing->mFillColor = color;
             drawing->mThickness = thickness;
+            drawing->mChanges   = mChanges;
 
             mDrawingsLine[id] = drawing;
 
+            mIsDrawOrderDirty = true;
+
+            MarkChanged();
+
             return *this;
         }
 
@@ -477,9 +724,14 @@ namespace Orbis {
             drawing->mOutlineColor     = outline_color;
             drawing->mIsRounded        = is_rounded;
             drawing->mRoundingRadius   = rounding_radius;
+            drawing->mChanges          = mChanges;
 
             mDrawingsRect[id] = drawing;
 
+            mIsDrawOrderDirty = true;
+
+            MarkChanged();
+
             return *this;
         }
 
@@ -495,9 +747,14 @@ namespace Orbis {
             drawing->mFont      = font;
             drawing->mAlign     = align;
             drawing->mText      = text;
+            drawing->mChanges   = mChanges;
 
             mDrawingsText[id] = drawing;
 
+            mIsDrawOrderDirty = true;
+
+            MarkChanged();
+
             return *this;
         }
 
@@ -513,9 +770,14 @@ namespace Orbis {
             drawing->mFont      = font;
             drawing->mAlign     = align;
             drawing->mWText     = wtext;
+            drawing->mChanges   = mChanges;
 
             mDrawingsWText[id] = drawing;
 
+            mIsDrawOrderDirty = true;
+
+            MarkChanged();
+
             return *this;
         }
 
@@ -530,44 +792,192 @@ namespace Orbis {
             drawing->mFillColor = fill_color;
             drawing->mTexture   = texture;
             drawing->mScale     = scale;
+            drawing->mChanges   = mChanges;
 
             mDrawingsTexture[id] = drawing;
 
+            mIsDrawOrderDirty = true;
+
+            MarkChanged();
+
             return *this;
         }
 
-        Widget& PositionAnimation(sf::Vector2f target, float duration, std::function<void()> on_complete = nullptr, std::function<float(float)> easing = Anim::EaseOutQuad) {
-            if (mPosAnimation.has_value() == false) {
-                mPosAnimation = AnimationState();
-            }
+        // Plays frame_count frames of frame_size from the atlas region of the texture, starting right away.
+        // frames_per_second of 0 shows the first frame until Play() is called on the drawing.
+        Widget& DrawSprite(const std::string& id, sf::Vector2f size, sf::Vector2f position, size_t zlevel, sf::Color fill_color, std::shared_ptr<sf::Texture> texture, sf::IntRect atlas, sf::Vector2i frame_size, size_t frame_count, float frames_per_second, bool is_looping = true) {
+            auto drawing = std::make_shared<DrawingsSprite>();
+
+            drawing->mType            = DrawingType::Sprite;
+            drawing->mID              = id;
+            drawing->mSize            = size;
+            drawing->mPosition        = position;
+            drawing->mZLevel          = zlevel;
+            drawing->mFillColor       = fill_color;
+            drawing->mTexture         = texture;
+            drawing->mAtlas           = atlas;
+            drawing->mFrameSize       = frame_size;
+            drawing->mFrameCount      = frame_count;
+            drawing->mFramesPerSecond = frames_per_second;
+            drawing->mIsLooping       = is_looping;
+            drawing->mIsPlaying       = 0.0f < frames_per_second;
+            drawing->mFrame           = 0;
+            drawing->mChanges         = mChanges;
+
+            drawing->AnchorStart();
+
+            mDrawingsSprite[id] = drawing;
+
+            mIsDrawOrderDirty = true;
+
+            MarkChanged();
+
+            return *this;
+        }
+
+        // Animations start on the next update of the owning panel; requesting one again replaces the running one
+        Widget& PositionAnimation(sf::Vector2f target, float duration, std::function<void()> on_complete = nullptr, EasingCurve easing = Easing::OutQuad) {
+            mTweens.Push<sf::Vector2f>(*this, {}, TweenProperty::Position, mPosition, target, duration, std::move(on_complete), std::move(easing));
 
-            mPosAnimation->Start(mPosition, target, duration, std::move(on_complete));
-            mPosAnimation->SetEasing(easing);
+            MarkRequested();
+
+            return *this;
+        }
+
+        // Pulls the widget toward the target like a spring; a new target while it moves keeps its momentum
+        Widget& PositionSpring(sf::Vector2f target, SpringParams params = {}, std::function<void()> on_complete = nullptr) {
+            mTweens.PushSpring(*this, {}, TweenProperty::Position, mPosition, target, params, std::move(on_complete));
+
+            MarkRequested();
 
             return *this;
         }
 
         Widget& CancelAnimation() {
-            mPosAnimation.reset();
+            BeginTween(TweenProperty::Position);
+
+            MarkChanged();
 
             return *this;
         }
 
-        Widget& ScaleAnimation(sf::Vector2f target_scale, float duration, std::function<void()> on_complete = nullptr, std::function<float(float)> easing = Anim::EaseOutQuad) {
-            if (mScaleAnimation.has_value() == false) {
-                mScaleAnimation = AnimationState();
+        Widget& ScaleAnimation(sf::Vector2f target_scale, float duration, std::function<void()> on_complete = nullptr, EasingCurve easing = Easing::OutQuad) {
+            mTweens.Push<sf::Vector2f>(*this, {}, TweenProperty::Scale, GetTextureScale(), target_scale, duration, std::move(on_complete), std::move(easing));
+
+            MarkRequested();
+
+            return *this;
+        }
+
+        Widget& ScaleSpring(sf::Vector2f target_scale, SpringParams params = {}, std::function<void()> on_complete = nullptr) {
+            mTweens.PushSpring(*this, {}, TweenProperty::Scale, GetTextureScale(), target_scale, params, std::move(on_complete));
+
+            MarkRequested();
+
+            return *this;
+        }
+
+        // Drawing tweens resolve the id once, here; a drawing replaced under the same id stops animating
+        Widget& SizeAnimation(DrawingType type, const std::string& id, sf::Vector2f target, float duration, std::function<void()> on_complete = nullptr, EasingCurve easing = Easing::OutQuad) {
+            sf::Vector2f size = {0, 0};
+
+            if (type == DrawingType::Rect) {
+                size = FindDrawing(mDrawingsRect, id)->mSize;
+            }
+            else if (type == DrawingType::Texture) {
+                size = FindDrawing(mDrawingsTexture, id)->mSize;
+            }
+            else if (type == DrawingType::Sprite) {
+                size = FindDrawing(mDrawingsSprite, id)->mSize;
+            }
+            else {
+                throw std::runtime_error("Only rect, texture and sprite drawings can animate their size");
+            }
+
+            return DrawingAnimation<sf::Vector2f>(type, id, TweenProperty::Size, size, target, duration, std::move(on_complete), std::move(easing));
+        }
+
+        // Fill color of any drawing, which is the text color of texts
+        Widget& ColorAnimation(DrawingType type, const std::string& id, sf::Color target, float duration, std::function<void()> on_complete = nullptr, EasingCurve easing = Easing::OutQuad) {
+            sf::Color color = GetDrawing(type, id)->mFillColor;
+
+            return DrawingAnimation<sf::Color>(type, id, TweenProperty::FillColor, color, target, duration, std::move(on_complete), std::move(easing));
+        }
+
+        Widget& OutlineColorAnimation(const std::string& id, sf::Color target, float duration, std::function<void()> on_complete = nullptr, EasingCurve easing = Easing::OutQuad) {
+            sf::Color color = FindDrawing(mDrawingsRect, id)->mOutlineColor;
+
+            return DrawingAnimation<sf::Color>(DrawingType::Rect, id, TweenProperty::OutlineColor, color, target, duration, std::move(on_complete), std::move(easing));
+        }
+
+        // Opacity from 0 to 1, applied to the fill and outline alpha
+        Widget& AlphaAnimation(DrawingType type, const std::string& id, float target, float duration, std::function<void()> on_complete = nullptr, EasingCurve easing = Easing::OutQuad) {
+            float alpha = static_cast<float>(GetDrawing(type, id)->mFillColor.a) / 255.0f;
+
+            return DrawingAnimation<float>(type, id, TweenProperty::Alpha, alpha, target, duration, std::move(on_complete), std::move(easing));
+        }
+
+        // Panel-relative area that can receive pointer input
+        virtual sf::FloatRect GetHitBounds() const {
+            return sf::FloatRect(mPosition, mSize);
+        }
+
+        // True while the widget needs input even with the pointer elsewhere (drag, focus, held press)
+        virtual bool HasCapture() const {
+            return false;
+        }
+
+        // Next moment the widget changes on its own without input, e.g. a cursor blink or a sprite frame
+        virtual std::optional<std::chrono::steady_clock::time_point> GetNextDeadline() const {
+            std::optional<std::chrono::steady_clock::time_point> deadline;
+
+            for (const auto& [id, sprite] : mDrawingsSprite) {
+                deadline = Anim::GetEarlier(deadline, sprite->GetNextFrameTime(Clock::GetNow()));
             }
 
-            sf::Vector2f current_scale = {1.0f, 1.0f};
+            return deadline;
+        }
 
-            if (mDrawingsTexture.empty() == false) {
-                current_scale = mDrawingsTexture.begin()->second->mScale;
+        // True when the widget draws nothing but its own drawings, so its quads can share draw calls with the
+        // widgets around it; anything drawing directly to the window has to keep its quads flushed first
+        virtual bool IsQuadBatchable() const {
+            return false;
+        }
+
+        // Whether the widget can take keyboard focus and join its context's Tab order
+        virtual bool IsFocusable() const {
+            return false;
+        }
+
+        // Children of a container, positioned in its content space; they follow the container in Tab order
+        virtual std::span<const std::shared_ptr<Widget>> GetChildren() const {
+            return {};
+        }
+
+        // Bumped whenever children are added anywhere below the widget
+        virtual uint64_t GetStructureRevision() const {
+            return 0;
+        }
+
+        // Focus target for a press inside the hit bounds, the position given in the space the widget is placed in.
+        // Containers look among their children first.
+        virtual std::shared_ptr<Widget> FindFocusAt(sf::Vector2f position) {
+            (void)position;
+
+            if (IsFocusable() == false) {
+                return nullptr;
             }
 
-            mScaleAnimation->Start(current_scale, target_scale, duration, std::move(on_complete));
-            mScaleAnimation->SetEasing(easing);
+            return weak_from_this().lock();
+        }
 
-            return *this;
+        virtual void OnFocusChanged(bool is_focused) {
+            (void)is_focused;
+        }
+
+        // Keyboard input, delivered in arrival order and only to the context's focused widget
+        virtual void HandleKeyEvent(const InputEvent& event) {
+            (void)event;
         }
 
         virtual std::shared_ptr<Widget> CloneImpl() const                                            = 0;
@@ -0,0 +1,67 @@
+#define ORBIS_ALLOCATION_TRACKER_IMPLEMENTATION
+#include <Orbis/System/AllocationTracker.hpp>
+#include <Orbis/UI.hpp>
+
+#include <cstdio>
+
+using namespace Orbis;
+
+// Steady-state frames must not touch the heap, idle or animating
+namespace {
+    constexpr int kWarmupFrames = 10;
+    constexpr int kFrames       = 600;
+
+    uint64_t RunFrames(UIContext& context, sf::RenderWindow& window, int frames) {
+        Controls        controls;
+        AllocationScope scope;
+
+        for (int frame = 0; frame < frames; ++frame) {
+            context.Update(controls, false);
+            context.Render(window);
+        }
+
+        return scope.GetAllocations();
+    }
+} // namespace
+
+int main() {
+    sf::RenderWindow window(sf::VideoMode({200, 200}), "Orbis Test: Allocation");
+
+    UIContext context;
+
+    context.GetClock().SetMode(ClockMode::FixedStep).SetFixedStep(1.0f / 60.0f);
+
+    auto panel  = UI::CreatePanel();
+    auto canvas = UI::CreateWidget<WidgetType::Canvas>();
+
+    canvas
+        .SetSize({100, 100})
+        .SetPosition({10, 10})
+        .DrawRect("bg", {100, 100}, {0, 0}, 0, sf::Color::White)
+        .DrawRect("bar", {80, 10}, {10, 10}, 1, sf::Color::Red, false, 0, sf::Color::White, true, 4.0f);
+
+    panel
+        .SetSize({200, 200})
+        .AddWidget(canvas);
+
+    context.AddPanel(panel.GetShared());
+
+    RunFrames(context, window, kWarmupFrames);
+
+    uint64_t idle = RunFrames(context, window, kFrames);
+
+    // Starting the animations allocates, running them must not; they outlast the frames counted
+    float duration = 2.0f * kFrames / 60.0f;
+
+    canvas
+        .PositionAnimation({50, 50}, duration)
+        .SizeAnimation(DrawingType::Rect, "bar", {20, 10}, duration);
+
+    RunFrames(context, window, kWarmupFrames);
+
+    uint64_t animating = RunFrames(context, window, kFrames);
+
+    std::printf("Allocations over %d frames: idle %llu, animating %llu\n", kFrames, static_cast<unsigned long long>(idle), static_cast<unsigned long long>(animating));
+
+    return idle == 0 && animating == 0 ? 0 : 1;
+}
\ No newline at end of file
@@ -0,0 +1,14 @@
+#pragma once
+
+#include <cstdio>
+
+// Shared by the test programs: each failed check is printed and counted, and main returns nonzero if any failed
+inline int gFailures = 0;
+
+inline void Check(bool condition, const char* what) {
+    if (condition == false) {
+        std::printf("FAILED: %s\n", what);
+
+        ++gFailures;
+    }
+}
\ No newline at end of file
@@ -0,0 +1,134 @@
+#include <Orbis/System/GapBuffer.hpp>
+#include <Orbis/System/GlyphRun.hpp>
+
+#include "Check.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+using namespace Orbis;
+
+namespace {
+    // Small deterministic generator, so a failure reproduces on every platform
+    uint32_t gSeed = 12345;
+
+    uint32_t Next(uint32_t bound) {
+        gSeed = gSeed * 1664525u + 1013904223u;
+
+        return (gSeed >> 8) % bound;
+    }
+
+    std::u32string MakeText(size_t length) {
+        std::u32string text;
+
+        for (size_t i = 0; i < length; ++i) {
+            text.push_back(Next(8) == 0 ? U' ' : static_cast<char32_t>(U'a' + Next(26)));
+        }
+
+        return text;
+    }
+
+    // Edits jumping around the buffer have to move the gap without losing or duplicating a character
+    void TestEdits() {
+        GapBuffer      buffer(U"hello world");
+        std::u32string expected = U"hello world";
+        bool           is_same  = true;
+
+        for (int step = 0; step < 2000; ++step) {
+            size_t position = Next(static_cast<uint32_t>(expected.size() + 1));
+
+            if (Next(3) == 0 && expected.empty() == false) {
+                size_t count = 1 + Next(8);
+
+                buffer.Erase(position, count);
+                expected.erase(std::min(position, expected.size()), count);
+            }
+            else {
+                // Past the gap's size now and then, so the buffer grows mid-edit
+                std::u32string text = MakeText(Next(20) == 0 ? 100 : 1 + Next(4));
+
+                buffer.Insert(position, text);
+                expected.insert(position, text);
+            }
+
+            is_same = is_same && buffer.GetSize() == expected.size() && buffer.ToString() == expected;
+        }
+
+        Check(is_same, "edits keep the buffer equal to a plain string");
+
+        bool is_indexed = true;
+
+        for (size_t i = 0; i < expected.size(); ++i) {
+            is_indexed = is_indexed && buffer[i] == expected[i];
+        }
+
+        Check(is_indexed, "indexing reads across the gap");
+        Check(buffer.Substring(3, 10) == expected.substr(3, 10), "substring across the gap");
+        Check(buffer.Substring(expected.size() - 2) == expected.substr(expected.size() - 2), "substring to the end");
+
+        buffer.Erase(0, buffer.GetSize() + 10);
+
+        Check(buffer.IsEmpty() == true, "erasing past the end empties the buffer");
+    }
+
+    // A run spliced after every edit has to match one laid out again from scratch
+    void TestRunSplice() {
+        auto font = std::make_shared<sf::Font>();
+
+        GapBuffer buffer(U"The quick brown fox");
+        GlyphRun  run;
+        bool      is_same = true;
+
+        run.Assign(buffer, buffer.GetSize(), font, 16);
+
+        for (int step = 0; step < 500; ++step) {
+            size_t position = Next(static_cast<uint32_t>(buffer.GetSize() + 1));
+            size_t erased   = 0;
+            size_t inserted = 0;
+
+            if (Next(3) == 0 && buffer.IsEmpty() == false) {
+                erased = std::min(static_cast<size_t>(1 + Next(4)), buffer.GetSize() - position);
+
+                buffer.Erase(position, erased);
+            }
+            else {
+                std::u32string text = MakeText(1 + Next(3));
+
+                inserted = text.size();
+
+                buffer.Insert(position, text);
+            }
+
+            run.Splice(buffer, buffer.GetSize(), position, erased, inserted);
+
+            GlyphRun fresh;
+
+            fresh.Assign(buffer, buffer.GetSize(), font, 16);
+
+            is_same = is_same && run.GetSize() == fresh.GetSize();
+
+            for (size_t i = 0; i <= buffer.GetSize(); ++i) {
+                is_same = is_same && run.GetCursorX(i) == fresh.GetCursorX(i);
+            }
+        }
+
+        Check(is_same, "spliced run matches a fresh layout");
+
+        // A splice that does not add up to the new length leaves the run alone, to be laid out again
+        size_t size = run.GetSize();
+
+        buffer.Insert(0, U"xy");
+        run.Splice(buffer, buffer.GetSize(), 0, 0, 1);
+
+        Check(run.GetSize() == size, "mismatched splice is ignored");
+    }
+} // namespace
+
+int main() {
+    TestEdits();
+    TestRunSplice();
+
+    return gFailures == 0 ? 0 : 1;
+}
\ No newline at end of file
@@ -0,0 +1,132 @@
+#include <Orbis/UI.hpp>
+
+#include "Check.hpp"
+
+#include <memory>
+#include <string>
+
+using namespace Orbis;
+
+namespace {
+    // Five lines in view: without glyphs the font's line spacing falls back to one pixel
+    std::shared_ptr<LogConsole> MakeConsole() {
+        auto console = std::make_shared<LogConsole>();
+
+        console->SetSize({200, 5});
+        console->DrawText("style", 16, {0, 0}, 0, sf::Color::White, std::make_shared<sf::Font>());
+        console->SetLineStyle("style");
+
+        return console;
+    }
+
+    void Scroll(LogConsole& console, float delta) {
+        Controls   controls;
+        InputEvent event;
+
+        event.mType       = InputType::MouseWheel;
+        event.mPosition   = {10, 2};
+        event.mWheelDelta = delta;
+
+        controls.mEvents.Push(event);
+
+        console.UpdateImpl(controls, {0, 0});
+    }
+
+    // A full ring drops its oldest lines first, and a single append may carry many lines
+    void TestRing() {
+        auto console = MakeConsole();
+
+        console->SetCapacity(4);
+        console->Append("one\ntwo\nthree");
+
+        Check(console->GetLineCount() == 3, "every '\\n' starts a line");
+
+        console->Append("four");
+        console->Append("five\nsix");
+
+        Check(console->GetLineCount() == 4, "the ring stays at its capacity");
+
+        console->SetCapacity(2);
+
+        Check(console->GetLineCount() == 2, "shrinking drops the oldest lines");
+
+        console->SetCapacity(8);
+
+        for (int i = 0; i < 20; ++i) {
+            console->Append("line " + std::to_string(i));
+        }
+
+        Check(console->GetLineCount() == 8, "wrapping around many times keeps the capacity");
+
+        console->Clear();
+
+        Check(console->GetLineCount() == 0 && console->GetShownLineCount() == 0, "clear empties the ring");
+
+        console->SetCapacity(0);
+        console->Append("dropped");
+
+        Check(console->GetLineCount() == 0, "a zero capacity keeps nothing");
+    }
+
+    // Filtered lines stay in the ring and come back with the filter cleared; evicting the oldest line drops it from the shown ones
+    void TestFilter() {
+        auto console = MakeConsole();
+
+        console->SetCapacity(6);
+        console->Append("error: a\ninfo: b\nerror: c\ninfo: d");
+        console->SetFilter("error");
+
+        Check(console->GetLineCount() == 4 && console->GetShownLineCount() == 2, "filter shows only matching lines");
+
+        console->Append("error: e\ninfo: f");
+
+        Check(console->GetShownLineCount() == 3, "new matching lines are shown as they come");
+
+        console->Append("info: g");
+
+        Check(console->GetLineCount() == 6 && console->GetShownLineCount() == 2, "evicting a shown line hides it");
+
+        console->SetCapacity(3);
+
+        Check(console->GetShownLineCount() == 1, "shrinking rebuilds the shown lines");
+
+        console->SetFilter("");
+
+        Check(console->GetShownLineCount() == 3, "an empty filter shows everything kept");
+    }
+
+    // Scrolling up leaves the bottom, and a clone keeps the view where the original had it
+    void TestScrollAndClone() {
+        auto console = MakeConsole();
+
+        for (int i = 0; i < 20; ++i) {
+            console->Append("line " + std::to_string(i));
+        }
+
+        Check(console->IsStuckToBottom() == true, "a new console follows the newest line");
+
+        Scroll(*console, 1.0f);
+
+        Check(console->IsStuckToBottom() == false, "scrolling up leaves the bottom");
+
+        auto cloned = std::static_pointer_cast<LogConsole>(console->CloneImpl());
+
+        Check(cloned->IsStuckToBottom() == false, "a clone keeps the scroll position");
+
+        console->Append("more");
+        cloned->Append("more");
+
+        Scroll(*console, -100.0f);
+        Scroll(*cloned, -100.0f);
+
+        Check(console->IsStuckToBottom() == true && cloned->IsStuckToBottom() == true, "scrolling back down sticks again");
+    }
+} // namespace
+
+int main() {
+    TestRing();
+    TestFilter();
+    TestScrollAndClone();
+
+    return gFailures == 0 ? 0 : 1;
+}
\ No newline at end of file
@@ -0,0 +1,164 @@
+#include <Orbis/UI.hpp>
+
+#include "Check.hpp"
+
+#include <cstdint>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <vector>
+
+using namespace Orbis;
+
+namespace {
+    uint32_t gSeed = 2024;
+
+    uint32_t Next(uint32_t bound) {
+        gSeed = gSeed * 1664525u + 1013904223u;
+
+        return (gSeed >> 8) % bound;
+    }
+
+    InputEvent MakeKey(sf::Keyboard::Key key, bool is_control = false, bool is_shift = false) {
+        InputEvent event;
+
+        event.mType       = InputType::KeyPressed;
+        event.mKey        = key;
+        event.mIsCPressed = is_control;
+        event.mIsSPressed = is_shift;
+
+        return event;
+    }
+
+    InputEvent MakeChar(char32_t code) {
+        InputEvent event;
+
+        event.mType    = InputType::TextEntered;
+        event.mUnicode = code;
+
+        return event;
+    }
+
+    void Type(TextboxMulti& textbox, std::u32string_view text) {
+        for (char32_t code : text) {
+            textbox.HandleKeyEvent(code == U'\n' ? MakeKey(sf::Keyboard::Key::Enter) : MakeChar(code));
+        }
+    }
+
+    std::shared_ptr<TextboxMulti> MakeTextbox() {
+        auto textbox = std::make_shared<TextboxMulti>();
+
+        textbox->SetSize({400, 300});
+        textbox->DrawText("text", 16, {0, 0}, 0, sf::Color::White, std::make_shared<sf::Font>());
+        textbox->SetEditableText("text");
+        textbox->OnFocusChanged(true);
+
+        return textbox;
+    }
+
+    // The line index has to agree with the lines of the joined text after any edit
+    bool IsIndexConsistent(const TextboxMulti& textbox) {
+        std::u32string              text = textbox.GetTextContent().toUtf32();
+        std::vector<std::u32string> lines(1);
+
+        for (char32_t code : text) {
+            if (code == U'\n') {
+                lines.emplace_back();
+            }
+            else {
+                lines.back().push_back(code);
+            }
+        }
+
+        if (textbox.GetLineCount() != lines.size()) {
+            return false;
+        }
+
+        for (size_t i = 0; i < lines.size(); ++i) {
+            if (textbox.GetLine(i).toUtf32() != lines[i]) {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    void TestLineEdits() {
+        auto textbox = MakeTextbox();
+
+        textbox->SetText("alpha\nbeta\ngamma");
+
+        Check(textbox->GetLineCount() == 3, "SetText indexes every line");
+
+        // Breaking a line in the middle, then joining it back with Backspace
+        textbox->HandleKeyEvent(MakeKey(sf::Keyboard::Key::Down));
+        textbox->HandleKeyEvent(MakeKey(sf::Keyboard::Key::Right));
+        textbox->HandleKeyEvent(MakeKey(sf::Keyboard::Key::Right));
+        textbox->HandleKeyEvent(MakeKey(sf::Keyboard::Key::Enter));
+
+        Check(textbox->GetLineCount() == 4 && textbox->GetLine(1) == "be" && textbox->GetLine(2) == "ta", "Enter splits the line");
+        Check(textbox->GetCursorLine() == 2 && textbox->GetCursorColumn() == 0, "cursor moves to the new line");
+
+        textbox->HandleKeyEvent(MakeKey(sf::Keyboard::Key::Backspace));
+
+        Check(textbox->GetLineCount() == 3 && textbox->GetLine(1) == "beta", "Backspace joins the lines");
+
+        // Delete at the end of a line pulls the next one up
+        textbox->HandleKeyEvent(MakeKey(sf::Keyboard::Key::End));
+        textbox->HandleKeyEvent(MakeKey(sf::Keyboard::Key::Delete));
+
+        Check(textbox->GetLineCount() == 2 && textbox->GetLine(1) == "betagamma", "Delete joins the next line");
+
+        // A selection over a line break replaced by text with breaks of its own
+        textbox->HandleKeyEvent(MakeKey(sf::Keyboard::Key::Home, true));
+        textbox->HandleKeyEvent(MakeKey(sf::Keyboard::Key::Right));
+
+        for (int i = 0; i < 7; ++i) {
+            textbox->HandleKeyEvent(MakeKey(sf::Keyboard::Key::Right, false, true));
+        }
+
+        Type(*textbox, U"one\ntwo\nthree");
+
+        Check(IsIndexConsistent(*textbox) == true, "replaced selection keeps the index");
+        Check(textbox->GetLineCount() == 3 && textbox->GetLine(0) == "aone" && textbox->GetLine(2) == "threetagamma", "replaced selection spans the lines");
+
+        // Select all and overwrite
+        textbox->HandleKeyEvent(MakeKey(sf::Keyboard::Key::A, true));
+        Type(*textbox, U"x");
+
+        Check(textbox->GetLineCount() == 1 && textbox->GetLine(0) == "x", "select all and type replaces everything");
+    }
+
+    // Random typing, breaks, deletions and selections, checked against the joined text after every key
+    void TestRandomEdits() {
+        auto textbox = MakeTextbox();
+        bool is_same = true;
+
+        const sf::Keyboard::Key keys[] = {
+            sf::Keyboard::Key::Left, sf::Keyboard::Key::Right, sf::Keyboard::Key::Up,        sf::Keyboard::Key::Down,   sf::Keyboard::Key::Home,
+            sf::Keyboard::Key::End,  sf::Keyboard::Key::Enter, sf::Keyboard::Key::Backspace, sf::Keyboard::Key::Delete,
+        };
+
+        for (int step = 0; step < 3000; ++step) {
+            if (Next(2) == 0) {
+                textbox->HandleKeyEvent(MakeChar(static_cast<char32_t>(U'a' + Next(26))));
+            }
+            else {
+                textbox->HandleKeyEvent(MakeKey(keys[Next(std::size(keys))], Next(8) == 0, Next(4) == 0));
+            }
+
+            is_same = is_same && IsIndexConsistent(*textbox) == true;
+            is_same = is_same && textbox->GetCursorLine() < textbox->GetLineCount();
+            is_same = is_same && textbox->GetCursorColumn() <= textbox->GetLine(textbox->GetCursorLine()).getSize();
+        }
+
+        Check(is_same, "random edits keep the line index and cursor consistent");
+    }
+} // namespace
+
+int main() {
+    TestLineEdits();
+    TestRandomEdits();
+
+    return gFailures == 0 ? 0 : 1;
+}
\ No newline at end of file
@@ -0,0 +1,140 @@
+#include <Orbis/System/TimerWheel.hpp>
+
+#include "Check.hpp"
+
+#include <vector>
+
+using namespace Orbis;
+
+namespace {
+    // Each timer has to fire on the exact tick of its expiry, wherever it was placed and however far the wheel jumps
+    void TestCascades() {
+        // 1 s ticks keep every expiry exact in float, up to past the top level into the overflow list
+        Clock      clock(ClockMode::Manual);
+        TimerWheel wheel(1.0f);
+
+        const std::vector<uint64_t> expiries = {
+            1, 63, 64, 65, 127, 128,        // level 0 to 1
+            4095, 4096, 4097,               // level 1 to 2
+            262143, 262144, 262145,         // level 2 to 3
+            16777215, 16777216, 16777218,   // level 3 to 4
+            1073741760,                     // last slot of level 4
+            1073741824, 1073741824 + 128,   // overflow
+        };
+
+        auto start = clock.GetTime();
+
+        wheel.SetClock(&clock);
+        wheel.Advance(start);
+
+        std::vector<uint64_t> fired;
+
+        for (uint64_t expiry : expiries) {
+            wheel.Schedule(static_cast<float>(expiry), [&fired, expiry]() { fired.push_back(expiry); });
+        }
+
+        Check(wheel.GetSize() == expiries.size(), "every timer is scheduled");
+
+        for (size_t i = 0; i < expiries.size(); ++i) {
+            clock.SetTime(start + std::chrono::seconds(expiries[i] - 1));
+            wheel.Advance(clock.GetTime());
+
+            Check(fired.size() == i, "a timer fires no earlier than its expiry");
+
+            clock.SetTime(start + std::chrono::seconds(expiries[i]));
+            wheel.Advance(clock.GetTime());
+
+            Check(fired.size() == i + 1 && fired.back() == expiries[i], "a timer fires on its expiry");
+        }
+
+        Check(wheel.IsEmpty() == true, "one-shot timers are released");
+    }
+
+    // One Advance() over many slots still runs the callbacks in expiry order
+    void TestOrder() {
+        Clock      clock(ClockMode::Manual);
+        TimerWheel wheel(1.0f);
+
+        auto start = clock.GetTime();
+
+        wheel.SetClock(&clock);
+        wheel.Advance(start);
+
+        std::vector<int> fired;
+
+        for (int expiry : {70, 5, 4100, 3, 64}) {
+            wheel.Schedule(static_cast<float>(expiry), [&fired, expiry]() { fired.push_back(expiry); });
+        }
+
+        clock.SetTime(start + std::chrono::seconds(5000));
+        wheel.Advance(clock.GetTime());
+
+        Check(fired == std::vector<int>({3, 5, 64, 70, 4100}), "timers fire in expiry order");
+    }
+
+    // Delays count from the clock, not from the last Advance(), which an idle event-driven context may not have run in a while
+    void TestScheduleFromNow() {
+        Clock      clock(ClockMode::Manual);
+        TimerWheel wheel;
+        int        fired = 0;
+
+        wheel.SetClock(&clock);
+        wheel.Advance(clock.GetTime());
+
+        clock.Advance(10.0f);
+
+        TimerHandle handle = wheel.Schedule(0.1f, [&fired]() { ++fired; });
+
+        wheel.Advance(clock.GetTime());
+
+        Check(fired == 0, "a delay scheduled after an idle stretch doesn't fire right away");
+
+        clock.Advance(0.05f);
+        wheel.Advance(clock.GetTime());
+
+        Check(handle.Reschedule(0.1f) == true, "an active timer can be rescheduled");
+
+        clock.Advance(0.08f);
+        wheel.Advance(clock.GetTime());
+
+        Check(fired == 0, "a rescheduled delay counts from the reschedule");
+
+        clock.Advance(0.03f);
+        wheel.Advance(clock.GetTime());
+
+        Check(fired == 1 && handle.IsActive() == false, "a rescheduled timer fires once its new delay passed");
+    }
+
+    void TestRepeatingAndCancel() {
+        Clock      clock(ClockMode::Manual);
+        TimerWheel wheel;
+        int        repeats   = 0;
+        int        cancelled = 0;
+
+        wheel.SetClock(&clock);
+        wheel.Advance(clock.GetTime());
+
+        TimerHandle repeating = wheel.ScheduleRepeating(0.01f, 0.02f, [&repeats]() { ++repeats; });
+        TimerHandle one_shot  = wheel.Schedule(0.02f, [&cancelled]() { ++cancelled; });
+
+        Check(one_shot.Cancel() == true && one_shot.IsActive() == false, "a pending timer can be cancelled");
+
+        for (int ms = 1; ms <= 55; ++ms) {
+            clock.Advance(0.001f);
+            wheel.Advance(clock.GetTime());
+        }
+
+        Check(repeats == 3, "a repeating timer fires after its delay, then every interval");
+        Check(cancelled == 0, "a cancelled timer never fires");
+        Check(repeating.Cancel() == true && wheel.IsEmpty() == true, "cancelling a repeating timer releases it");
+    }
+} // namespace
+
+int main() {
+    TestCascades();
+    TestOrder();
+    TestScheduleFromNow();
+    TestRepeatingAndCancel();
+
+    return gFailures == 0 ? 0 : 1;
+}
\ No newline at end of file